@@ -3,6 +3,55 @@
 #include <functional>
 #include "Storage.hpp"
 
+// === EventQueue : événements différés d'une scène mise à jour en parallèle ===
+
+class EventQueue
+{
+    private:
+
+        std::vector<std::function<void(void)>> _pending;
+        std::vector<std::function<void(void)>> _flushing;
+
+        static EventQueue*& current(void)
+        {
+            thread_local EventQueue* queue = nullptr;
+            return queue;
+        }
+
+    public:
+
+        struct Scope
+        {
+            EventQueue* previous;
+
+            Scope(EventQueue& queue) : previous(current()) { current() = &queue; }
+            ~Scope(void) { current() = previous; }
+        };
+
+        static EventQueue* active(void)
+        {
+            return current();
+        }
+
+        void push(std::function<void(void)> deferred)
+        {
+            _pending.push_back(std::move(deferred));
+        }
+
+        void flush(void)
+        {
+            _flushing.swap(_pending);
+            for (auto& deferred : _flushing)
+                deferred();
+            _flushing.clear();
+        }
+
+        std::size_t size(void) const
+        {
+            return _pending.size();
+        }
+};
+
 // === EventTrait
 
 template <typename T>
@@ -12,9 +61,27 @@ class EventDispatcher
 
         int _nextId;
         std::vector<std::pair<int, std::function<void(const T&)>>> _handlers;
+        std::function<void(const T&)> _recorder;
+        const void* _recorderOwner = nullptr;
 
     public:
 
+        // Appelé à chaque dispatch, avant les handlers (ex. EventJournal) ; le dernier posé gagne
+        void setRecorder(std::function<void(const T&)> recorder, const void* owner = nullptr)
+        {
+            _recorder = std::move(recorder);
+            _recorderOwner = _recorder ? owner : nullptr;
+        }
+
+        // Ne retire l'enregistreur que s'il appartient encore à owner
+        void clearRecorder(const void* owner)
+        {
+            if (_recorderOwner != owner)
+                return;
+            _recorder = nullptr;
+            _recorderOwner = nullptr;
+        }
+
         int subscribe(std::function<void(const T&)> handler)
         {
             int id = _nextId++;
@@ -31,6 +98,8 @@ class EventDispatcher
 
         void publish(const T& event)
         {
+            if (_recorder)
+                _recorder(event);
             for (const auto& h : _handlers)
                 h.second(event);
         }
@@ -61,9 +130,26 @@ class EventBus
             getDispatcher<T>().unsubscribe(id);
         }
 
+        template <typename T>
+        void setRecorder(std::function<void(const T&)> recorder, const void* owner = nullptr)
+        {
+            getDispatcher<T>().setRecorder(std::move(recorder), owner);
+        }
+
+        template <typename T>
+        void clearRecorder(const void* owner)
+        {
+            getDispatcher<T>().clearRecorder(owner);
+        }
+
         template <typename T>
         void publish(const T& e)
         {
+            if (EventQueue* queue = EventQueue::active())
+            {
+                queue->push([this, e]() { getDispatcher<T>().publish(e); });
+                return;
+            }
             getDispatcher<T>().publish(e);
         }
 
@@ -3,7 +3,13 @@
 #include "System.hpp"
 #include "RunTimeInspector.hpp"
 #include "Bus.hpp"
+#include "ThreadPool.hpp"
+#include "Snapshot.hpp"
+#include "Streaming.hpp"
+#include "Journal.hpp"
+#include "LiveInspector.hpp"
 #include <unordered_map>
+#include <map>
 #include <typeindex>
 #include <functional>
 
@@ -16,6 +22,8 @@ class IScene
         virtual ~IScene(void) = default;
         virtual void update(double) = 0;
         virtual const std::string& name(void) = 0;
+        virtual void clear(void) = 0;
+        virtual std::type_index componentListType(void) const = 0;
 };
 
 template <typename ComponentList>
@@ -27,16 +35,53 @@ class Scene : public IScene
         Registry<ComponentList> _registry;
         SystemManager<ComponentList> _systems;
         std::unordered_map<std::type_index, std::function<void(const void*)>> _routers;
+        std::unique_ptr<SnapshotPublisher<ComponentList>> _publisher;
+        std::vector<std::function<void(void)>> _subscriptions;
+        std::unique_ptr<WorldStreamer<ComponentList>> _streamer;
+        std::unique_ptr<LiveInspector<ComponentList>> _live;
 
     public:
 
         Scene(const std::string& name) : _sceneName(name) {}
-        virtual ~Scene(void) = default;
+
+        virtual ~Scene(void)
+        {
+            unbindRouters();
+        }
+
+        void rename(const std::string& name)
+        {
+            _sceneName = name;
+        }
+
+        // Vide la scène pour réutilisation : registry (capacités conservées), systèmes, routeurs
+        void clear(void) override
+        {
+            unbindRouters();
+            _routers.clear();
+            _systems.clear();
+            _publisher.reset();
+            _streamer.reset();
+            _live.reset();
+            _registry.clear();
+        }
+
+        std::type_index componentListType(void) const override
+        {
+            return typeid(ComponentList);
+        }
+
+        void unbindRouters(void)
+        {
+            for (auto& unsubscribe : _subscriptions)
+                unsubscribe();
+            _subscriptions.clear();
+        }
 
         template <typename T>
-        void addSystem(T* sys, int priority = 0)
+        ISystem& addSystem(T* sys, int priority = 0)
         {
-            _systems.addSystem(sys, _registry, priority);
+            return _systems.addSystem(sys, _registry, priority);
         }
 
         Registry<ComponentList>& getRegistry(void)
@@ -47,7 +92,52 @@ class Scene : public IScene
         void update(double dt) override
         {
             std::cout << "Scene [" << _sceneName << "] ";
+            if (_streamer)
+                _streamer->commit(_registry);
             _systems.update(dt, _registry);
+            if (_publisher)
+                _publisher->publish(_registry);
+            if (_live)
+                _live->publish(_registry, _systems);
+        }
+
+        // Publie un snapshot en lecture seule à la fin de chaque update
+        void enableSnapshots(void)
+        {
+            if (!_publisher)
+            {
+                _publisher = std::make_unique<SnapshotPublisher<ComponentList>>();
+                _publisher->publish(_registry);
+            }
+        }
+
+        std::shared_ptr<const RegistrySnapshot<ComponentList>> snapshot(void) const
+        {
+            return _publisher ? _publisher->acquire() : nullptr;
+        }
+
+        // Cellules du monde déchargées dans directory, fusionnées en début de chaque update
+        WorldStreamer<ComponentList>& enableStreaming(const std::string& directory)
+        {
+            if (!_streamer)
+                _streamer = std::make_unique<WorldStreamer<ComponentList>>(directory);
+            return *_streamer;
+        }
+
+        WorldStreamer<ComponentList>* streamer(void)
+        {
+            return _streamer.get();
+        }
+
+        // Publie registry et timings dans le segment partagé segment (lu par liveMonitor)
+        bool enableLiveInspection(const std::string& segment, std::uint64_t everyNFrames = 1)
+        {
+            auto live = std::make_unique<LiveInspector<ComponentList>>();
+            if (!live->open(segment))
+                return false;
+            live->setEveryNFrames(everyNFrames);
+            _live = std::move(live);
+            return true;
         }
 
         const std::string& name(void) override
@@ -60,6 +150,16 @@ class Scene : public IScene
             return _systems.systems();
         }
 
+        const SystemManager<ComponentList>& systemManager(void) const
+        {
+            return _systems;
+        }
+
+        JobScheduler& jobs(void)
+        {
+            return _systems.jobs();
+        }
+
         template <typename Event, typename T>
         void routeEvent(const Event& evt)
         {
@@ -72,10 +172,20 @@ class Scene : public IScene
             }
             else
             {
-                reg.template forEachEntityWith<TypeList<T>>([&](Entity e, T& comp) {
-                    (void)comp;
-                    handleEvent(this, evt, e);
-                });
+                // Les tags vides ne sont pas passés au callback de forEachEntityWith
+                if constexpr (std::is_empty_v<T>)
+                {
+                    reg.template forEachEntityWith<TypeList<T>>([&](Entity e) {
+                        handleEvent(this, evt, e);
+                    });
+                }
+                else
+                {
+                    reg.template forEachEntityWith<TypeList<T>>([&](Entity e, T& comp) {
+                        (void)comp;
+                        handleEvent(this, evt, e);
+                    });
+                }
             }
         }
 
@@ -91,11 +201,12 @@ class Scene : public IScene
         template <typename Event>
         void bindRouter(void)
         {
-            EventBus::instance().subscribe<Event>([this](const Event& evt) {
+            int id = EventBus::instance().subscribe<Event>([this](const Event& evt) {
                 auto it = _routers.find(typeid(Event));
                 if (it != _routers.end())
                     it->second(&evt);
             });
+            _subscriptions.push_back([id]() { EventBus::instance().unsubscribe<Event>(id); });
         }
 
         std::vector<std::string> listActiveSystem(void) const
@@ -113,34 +224,124 @@ class GameManager
 {
     private:
 
-        std::unordered_map<std::string, std::pair<std::unique_ptr<IScene>, bool>> _scenes;
+        struct SceneSlot
+        {
+            std::unique_ptr<IScene> scene;
+            bool active = false;
+            EventQueue events;
+        };
+
+        std::map<std::string, SceneSlot> _scenes;
+        std::unordered_map<std::type_index, std::vector<std::unique_ptr<IScene>>> _recycled;
+        std::unique_ptr<ThreadPool> _pool;
+        std::unique_ptr<EventJournal> _journal;
+
+        void updateSequential(double dt)
+        {
+            for (auto& [name, slot] : _scenes)
+            {
+                if (slot.active)
+                {
+                    std::cout << "Scene[" << name << "] ";
+                    slot.scene->update(dt);
+                }
+            }
+        }
+
+        // Chaque scène active tourne sur le pool, ses événements publiés sont
+        // mis en file puis dispatchés sur le thread appelant après la barrière,
+        // dans l'ordre des noms de scène
+        void updateParallel(double dt)
+        {
+            for (auto& [name, slot] : _scenes)
+            {
+                if (slot.active)
+                {
+                    SceneSlot* s = &slot;
+                    _pool->submit([s, dt]() {
+                        EventQueue::Scope scope(s->events);
+                        s->scene->update(dt);
+                    });
+                }
+            }
+            _pool->wait();
+            for (auto& [name, slot] : _scenes)
+                slot.events.flush();
+        }
 
     public:
 
         GameManager(void) = default;
         virtual ~GameManager(void) = default;
 
+        // Réutilise une scène vidée du même ComponentList si le pool en contient une
         template <typename ComponentList>
         Scene<ComponentList>& createScene(const std::string& name, bool active = false, std::size_t alloc = 100)
         {
-            auto scene = std::make_unique<Scene<ComponentList>>(name);
+            std::unique_ptr<Scene<ComponentList>> scene;
+            auto& pool = _recycled[typeid(ComponentList)];
+            if (!pool.empty())
+            {
+                scene.reset(static_cast<Scene<ComponentList>*>(pool.back().release()));
+                pool.pop_back();
+                scene->rename(name);
+            }
+            else
+                scene = std::make_unique<Scene<ComponentList>>(name);
             scene->getRegistry().preAllocate(alloc);
             Scene<ComponentList>* ptr = scene.get();
-            _scenes[name] = {std::move(scene), active};
+            SceneSlot& slot = _scenes[name];
+            slot.scene = std::move(scene);
+            slot.active = active;
             return *ptr;
         }
 
+        // Retire la scène, la vide et la garde pour le prochain createScene du même type
+        void releaseScene(const std::string& name)
+        {
+            auto it = _scenes.find(name);
+            if (it == _scenes.end())
+                return;
+            std::unique_ptr<IScene> scene = std::move(it->second.scene);
+            _scenes.erase(it);
+            scene->clear();
+            _recycled[scene->componentListType()].push_back(std::move(scene));
+        }
+
+        std::size_t pooledScenes(void) const
+        {
+            std::size_t count = 0;
+            for (const auto& entry : _recycled)
+                count += entry.second.size();
+            return count;
+        }
+
         void setActiveScene(const std::string& name, bool b)
         {
             auto it = _scenes.find(name);
             if (it != _scenes.end())
-                it->second.second = b;
+                it->second.active = b;
         }
 
         IScene* getScene(const std::string& name)
         {
             auto it = _scenes.find(name);
-            return it != _scenes.end() ? it->second.first.get() : nullptr;
+            return it != _scenes.end() ? it->second.scene.get() : nullptr;
+        }
+
+        void enableParallel(std::size_t threads = std::thread::hardware_concurrency())
+        {
+            _pool = std::make_unique<ThreadPool>(threads);
+        }
+
+        void disableParallel(void)
+        {
+            _pool.reset();
+        }
+
+        bool isParallel(void) const
+        {
+            return _pool != nullptr;
         }
 
         void run(int frames = 3, double dt = 1.0)
@@ -148,26 +349,40 @@ class GameManager
             for (int i = 0; i < frames; i++)
             {
                 std::cout << "\nFrame " << i << std::endl;
-                for (auto& [name, scene] : _scenes)
-                {
-                    if (scene.second)
-                    {
-                        std::cout << "Scene[" << name << "] ";
-                        scene.first->update(dt);
-                    }
-                }
+                update(dt);
             }
         }
 
         void update(double dt)
         {
-            for (auto& [name, scene] : _scenes)
-            {
-                if (scene.second)
-                {
-                    std::cout << "Scene[" << name << "] ";
-                    scene.first->update(dt);
-                }
-            }
+            if (_journal)
+                _journal->beginFrame(dt);
+            if (_pool)
+                updateParallel(dt);
+            else
+                updateSequential(dt);
+            if (_journal)
+                _journal->endFrame();
+        }
+
+        // Journal des dt et des événements suivis (journal->track<Event>()) ; nullptr si path
+        // ne peut pas être ouvert
+        EventJournal* enableJournal(const std::string& path, std::size_t ringBytes = 1 << 20)
+        {
+            auto journal = std::make_unique<EventJournal>(ringBytes);
+            if (!journal->open(path))
+                return nullptr;
+            _journal = std::move(journal);
+            return _journal.get();
+        }
+
+        void disableJournal(void)
+        {
+            _journal.reset();
+        }
+
+        EventJournal* journal(void)
+        {
+            return _journal.get();
         }
 };
\ No newline at end of file
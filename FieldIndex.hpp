@@ -0,0 +1,291 @@
+#pragma once
+
+#include "Registry.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// === Index secondaires sur un champ de composant, choisi par son rang dans tie() ===
+// Les ajouts, retraits et accès mutables sont notés via ComponentObserver et appliqués
+// au début de la requête suivante : une plage renvoyée reste valide pendant qu'on l'itère.
+
+template <typename T, std::size_t Field>
+using FieldType = std::decay_t<std::tuple_element_t<Field, decltype(std::declval<const T&>().tie(std::declval<const T&>()))>>;
+
+template <typename T, std::size_t Field>
+FieldType<T, Field> fieldValue(const T& comp)
+{
+    return std::get<Field>(comp.tie(comp));
+}
+
+template <typename ComponentList, typename T>
+class DeferredIndex : public ComponentObserver<T>
+{
+    protected:
+
+        Registry<ComponentList>& _registry;
+        std::vector<Entity> _dirty;
+        std::vector<std::uint32_t> _dirtySlots;   // rang + 1 dans _dirty, 0 si propre
+
+        // Un id recyclé avant le rafraîchissement remplace l'ancien handle : seul le dernier est indexé
+        void mark(Entity e)
+        {
+            if (e.id() >= _dirtySlots.size())
+                _dirtySlots.resize(e.id() + 1, 0);
+            std::uint32_t& slot = _dirtySlots[e.id()];
+            if (slot)
+            {
+                _dirty[slot - 1] = e;
+                return;
+            }
+            _dirty.push_back(e);
+            slot = static_cast<std::uint32_t>(_dirty.size());
+        }
+
+    public:
+
+        DeferredIndex(Registry<ComponentList>& reg) : _registry(reg)
+        {
+            const auto& pool = std::as_const(_registry).template storage<T>();
+            for (std::size_t i = 0; i < pool.size(); i++)
+                mark(pool.entityAt(i));
+            _registry.template connect<T>(this);
+        }
+
+        virtual ~DeferredIndex(void)
+        {
+            _registry.template disconnect<T>(this);
+        }
+
+        DeferredIndex(const DeferredIndex&) = delete;
+        DeferredIndex& operator=(const DeferredIndex&) = delete;
+
+        void onAdd(Entity e, const T&) override { mark(e); }
+        void onRemove(Entity e, const T&) override { mark(e); }
+        void onPatch(Entity e) override { mark(e); }
+
+        void onClear(void) override
+        {
+            _dirty.clear();
+            _dirtySlots.clear();
+            reset();
+        }
+
+        virtual void reset(void) = 0;
+
+        std::size_t pending(void) const
+        {
+            return _dirty.size();
+        }
+};
+
+// === SortedIndex : requêtes d'intervalle, O(n + d log d) par rafraîchissement ===
+
+template <typename ComponentList, typename T, std::size_t Field = 0>
+class SortedIndex : public DeferredIndex<ComponentList, T>
+{
+    public:
+
+        using Key = FieldType<T, Field>;
+
+    private:
+
+        using Base = DeferredIndex<ComponentList, T>;
+
+        std::vector<Key> _keys;
+        std::vector<Entity> _entities;
+        std::vector<std::pair<Key, Entity>> _incoming;
+        std::vector<Key> _mergedKeys;
+        std::vector<Entity> _mergedEntities;
+
+        EntityRange slice(std::size_t first, std::size_t last) const
+        {
+            return {_entities.data() + first, _entities.data() + last};
+        }
+
+    public:
+
+        SortedIndex(Registry<ComponentList>& reg) : Base(reg) {}
+
+        void reset(void) override
+        {
+            _keys.clear();
+            _entities.clear();
+        }
+
+        void refresh(void)
+        {
+            if (this->_dirty.empty())
+                return;
+            const auto& pool = std::as_const(this->_registry).template storage<T>();
+
+            // Retire en une passe toutes les entrées des entités modifiées
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < _entities.size(); i++)
+            {
+                Entity e = _entities[i];
+                if (e.id() < this->_dirtySlots.size() && this->_dirtySlots[e.id()])
+                    continue;
+                _keys[kept] = std::move(_keys[i]);
+                _entities[kept] = e;
+                kept++;
+            }
+            _keys.resize(kept);
+            _entities.resize(kept);
+
+            _incoming.clear();
+            for (Entity e : this->_dirty)
+            {
+                this->_dirtySlots[e.id()] = 0;
+                if (pool.has(e))
+                    _incoming.emplace_back(fieldValue<T, Field>(pool.get(e)), e);
+            }
+            this->_dirty.clear();
+            std::sort(_incoming.begin(), _incoming.end(), [](const auto& a, const auto& b) {
+                return a.first < b.first;
+            });
+
+            _mergedKeys.clear();
+            _mergedEntities.clear();
+            std::size_t i = 0;
+            std::size_t j = 0;
+            while (i < _keys.size() || j < _incoming.size())
+            {
+                if (j == _incoming.size() || (i < _keys.size() && !(_incoming[j].first < _keys[i])))
+                {
+                    _mergedKeys.push_back(std::move(_keys[i]));
+                    _mergedEntities.push_back(_entities[i++]);
+                }
+                else
+                {
+                    _mergedKeys.push_back(std::move(_incoming[j].first));
+                    _mergedEntities.push_back(_incoming[j++].second);
+                }
+            }
+            _keys.swap(_mergedKeys);
+            _entities.swap(_mergedEntities);
+        }
+
+        EntityRange equal(const Key& key)
+        {
+            refresh();
+            auto bounds = std::equal_range(_keys.begin(), _keys.end(), key);
+            return slice(bounds.first - _keys.begin(), bounds.second - _keys.begin());
+        }
+
+        // Intervalle fermé [lo, hi]
+        EntityRange between(const Key& lo, const Key& hi)
+        {
+            refresh();
+            auto first = std::lower_bound(_keys.begin(), _keys.end(), lo);
+            auto last = std::upper_bound(first, _keys.end(), hi);
+            return slice(first - _keys.begin(), last - _keys.begin());
+        }
+
+        EntityRange atLeast(const Key& lo)
+        {
+            refresh();
+            auto first = std::lower_bound(_keys.begin(), _keys.end(), lo);
+            return slice(first - _keys.begin(), _keys.size());
+        }
+
+        EntityRange below(const Key& hi)
+        {
+            refresh();
+            auto last = std::lower_bound(_keys.begin(), _keys.end(), hi);
+            return slice(0, last - _keys.begin());
+        }
+
+        EntityRange all(void)
+        {
+            refresh();
+            return slice(0, _keys.size());
+        }
+};
+
+// === HashIndex : requêtes d'égalité, O(1) par entité modifiée ===
+
+template <typename ComponentList, typename T, std::size_t Field = 0>
+class HashIndex : public DeferredIndex<ComponentList, T>
+{
+    public:
+
+        using Key = FieldType<T, Field>;
+
+    private:
+
+        using Base = DeferredIndex<ComponentList, T>;
+
+        struct Slot
+        {
+            bool indexed = false;
+            std::uint32_t index = 0;
+            Key key {};
+        };
+
+        std::unordered_map<Key, std::vector<Entity>> _buckets;
+        std::vector<Slot> _slots;
+
+        void erase(Slot& s)
+        {
+            auto& bucket = _buckets[s.key];
+            if (s.index != bucket.size() - 1)
+            {
+                bucket[s.index] = bucket.back();
+                _slots[bucket[s.index].id()].index = s.index;
+            }
+            bucket.pop_back();
+            s.indexed = false;
+        }
+
+    public:
+
+        HashIndex(Registry<ComponentList>& reg) : Base(reg) {}
+
+        void reset(void) override
+        {
+            for (auto& bucket : _buckets)
+                bucket.second.clear();
+            _slots.clear();
+        }
+
+        void refresh(void)
+        {
+            const auto& pool = std::as_const(this->_registry).template storage<T>();
+            for (Entity e : this->_dirty)
+            {
+                this->_dirtySlots[e.id()] = 0;
+                if (e.id() >= _slots.size())
+                    _slots.resize(e.id() + 1);
+                Slot& s = _slots[e.id()];
+                if (s.indexed)
+                    erase(s);
+                if (!pool.has(e))
+                    continue;
+                s.key = fieldValue<T, Field>(pool.get(e));
+                auto& bucket = _buckets[s.key];
+                s.index = static_cast<std::uint32_t>(bucket.size());
+                s.indexed = true;
+                bucket.push_back(e);
+            }
+            this->_dirty.clear();
+        }
+
+        EntityRange equal(const Key& key)
+        {
+            refresh();
+            auto it = _buckets.find(key);
+            if (it == _buckets.end())
+                return {};
+            return {it->second.data(), it->second.data() + it->second.size()};
+        }
+
+        std::size_t count(const Key& key)
+        {
+            return equal(key).size();
+        }
+};
\ No newline at end of file
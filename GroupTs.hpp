@@ -46,7 +46,7 @@ class GroupTs
             auto& pool = _registry.template storage<Ts...>().template entities();
             for (Entity e : pool)
             {
-                if (_registry.template hasAll<TypeList<Ts...>>(e))
+                if (_registry.isEnabled(e) && _registry.template hasAll<TypeList<Ts...>>(e))
                     _entities.push_back(e);
             }
         }        
@@ -0,0 +1,234 @@
+#pragma once
+
+#include "Storage.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// === HierarchyStorage : relation parent / enfants rangée en ordre préfixe ===
+// Chaque sous-arbre occupe un bloc contigu de _order, un parent précède toujours ses
+// enfants : propager une valeur du parent vers l'enfant est un seul parcours linéaire.
+
+class HierarchyStorage
+{
+    public:
+
+        struct Node
+        {
+            Entity self = INVALID_ENTITY;
+            Entity parent = INVALID_ENTITY;
+            Entity firstChild = INVALID_ENTITY;
+            Entity nextSibling = INVALID_ENTITY;
+            Entity prevSibling = INVALID_ENTITY;
+            std::uint32_t size = 0;
+            std::uint32_t depth = 0;
+        };
+
+    private:
+
+        std::vector<Node> _nodes;
+        std::vector<std::uint32_t> _position;
+        std::vector<Entity> _order;
+
+        Node& node(Entity e)
+        {
+            return _nodes[e.id()];
+        }
+
+        void insertRoot(Entity e)
+        {
+            if (e.id() >= _nodes.size())
+            {
+                _nodes.resize(e.id() + 1);
+                _position.resize(e.id() + 1, 0);
+            }
+            Node& n = node(e);
+            n = Node {};
+            n.self = e;
+            n.size = 1;
+            _position[e.id()] = static_cast<std::uint32_t>(_order.size());
+            _order.push_back(e);
+        }
+
+        void resize(Entity from, std::int64_t delta)
+        {
+            for (Entity a = from; a != INVALID_ENTITY; a = node(a).parent)
+                node(a).size = static_cast<std::uint32_t>(node(a).size + delta);
+        }
+
+        void unlink(Entity e)
+        {
+            Node& n = node(e);
+            if (n.parent == INVALID_ENTITY)
+                return;
+            if (n.prevSibling != INVALID_ENTITY)
+                node(n.prevSibling).nextSibling = n.nextSibling;
+            else
+                node(n.parent).firstChild = n.nextSibling;
+            if (n.nextSibling != INVALID_ENTITY)
+                node(n.nextSibling).prevSibling = n.prevSibling;
+            resize(n.parent, -static_cast<std::int64_t>(n.size));
+            n.parent = INVALID_ENTITY;
+            n.prevSibling = INVALID_ENTITY;
+            n.nextSibling = INVALID_ENTITY;
+        }
+
+        void reindex(std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first; i < last; i++)
+                _position[_order[i].id()] = static_cast<std::uint32_t>(i);
+        }
+
+        // Déplace le bloc [from, from + len) devant l'élément d'indice to ; renvoie son nouveau début
+        std::size_t moveBlock(std::size_t from, std::size_t len, std::size_t to)
+        {
+            if (to < from)
+            {
+                std::rotate(_order.begin() + to, _order.begin() + from, _order.begin() + from + len);
+                reindex(to, from + len);
+                return to;
+            }
+            if (to > from + len)
+            {
+                std::rotate(_order.begin() + from, _order.begin() + from + len, _order.begin() + to);
+                reindex(from, to);
+                return to - len;
+            }
+            return from;
+        }
+
+        void shiftDepth(std::size_t first, std::size_t len, std::int64_t delta)
+        {
+            if (delta == 0)
+                return;
+            for (std::size_t i = first; i < first + len; i++)
+                node(_order[i]).depth = static_cast<std::uint32_t>(node(_order[i]).depth + delta);
+        }
+
+    public:
+
+        bool contains(Entity e) const
+        {
+            return e.id() < _nodes.size() && _nodes[e.id()].self == e && _nodes[e.id()].size != 0;
+        }
+
+        const Node* find(Entity e) const
+        {
+            return contains(e) ? &_nodes[e.id()] : nullptr;
+        }
+
+        Entity parentOf(Entity e) const
+        {
+            return contains(e) ? _nodes[e.id()].parent : INVALID_ENTITY;
+        }
+
+        bool isAncestor(Entity ancestor, Entity e) const
+        {
+            if (!contains(ancestor) || !contains(e))
+                return false;
+            std::uint32_t a = _position[ancestor.id()];
+            std::uint32_t p = _position[e.id()];
+            return p >= a && p < a + _nodes[ancestor.id()].size;
+        }
+
+        // child (et son sous-arbre) devient le premier enfant de parent ; refuse les cycles
+        bool attach(Entity child, Entity parent)
+        {
+            if (child == parent || child == INVALID_ENTITY || parent == INVALID_ENTITY)
+                return false;
+            if (!contains(child))
+                insertRoot(child);
+            if (!contains(parent))
+                insertRoot(parent);
+            if (isAncestor(child, parent))
+                return false;
+
+            unlink(child);
+            Node& c = node(child);
+            Node& p = node(parent);
+            c.parent = parent;
+            c.nextSibling = p.firstChild;
+            if (p.firstChild != INVALID_ENTITY)
+                node(p.firstChild).prevSibling = child;
+            p.firstChild = child;
+            resize(parent, c.size);
+
+            std::int64_t delta = static_cast<std::int64_t>(p.depth) + 1 - c.depth;
+            std::size_t start = moveBlock(_position[child.id()], c.size, _position[parent.id()] + 1);
+            shiftDepth(start, c.size, delta);
+            return true;
+        }
+
+        // child redevient une racine, son bloc part en fin d'ordre
+        void detach(Entity child)
+        {
+            if (!contains(child) || node(child).parent == INVALID_ENTITY)
+                return;
+            unlink(child);
+            Node& c = node(child);
+            std::size_t start = moveBlock(_position[child.id()], c.size, _order.size());
+            shiftDepth(start, c.size, -static_cast<std::int64_t>(c.depth));
+        }
+
+        // Retire un seul nœud, ses enfants deviennent des racines
+        void erase(Entity e)
+        {
+            if (!contains(e))
+                return;
+            while (node(e).firstChild != INVALID_ENTITY)
+                detach(node(e).firstChild);
+            unlink(e);
+            std::size_t at = _position[e.id()];
+            _order.erase(_order.begin() + at);
+            reindex(at, _order.size());
+            node(e) = Node {};
+        }
+
+        // Bloc contigu du sous-arbre, racine en tête ; invalidé par toute modification
+        EntityRange subtree(Entity root) const
+        {
+            if (!contains(root))
+                return {};
+            const Entity* first = _order.data() + _position[root.id()];
+            return {first, first + _nodes[root.id()].size};
+        }
+
+        // Retire tout le sous-arbre en un seul effacement de bloc
+        void eraseSubtree(Entity root)
+        {
+            if (!contains(root))
+                return;
+            unlink(root);
+            std::size_t at = _position[root.id()];
+            std::size_t len = node(root).size;
+            for (std::size_t i = at; i < at + len; i++)
+                node(_order[i]) = Node {};
+            _order.erase(_order.begin() + at, _order.begin() + at + len);
+            reindex(at, _order.size());
+        }
+
+        // Ordre préfixe : fnc(entité, parent) voit toujours le parent avant l'enfant
+        template <typename Func>
+        void forEachDepthFirst(Func&& fnc) const
+        {
+            for (Entity e : _order)
+                fnc(e, _nodes[e.id()].parent);
+        }
+
+        EntityRange order(void) const
+        {
+            return {_order.data(), _order.data() + _order.size()};
+        }
+
+        std::size_t size(void) const
+        {
+            return _order.size();
+        }
+
+        void clear(void)
+        {
+            _nodes.clear();
+            _position.clear();
+            _order.clear();
+        }
+};
\ No newline at end of file
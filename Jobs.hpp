@@ -0,0 +1,249 @@
+#pragma once
+
+#include "Storage.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__cpp_impl_coroutine)
+    #include <coroutine>
+    #include <exception>
+    #include <optional>
+#endif
+
+// === JobScheduler : travaux asynchrones repris sur le thread de simulation ===
+// Le travail tourne sur un pool, la suite est exécutée lors de drain(), appelé par
+// SystemManager::update avant les systèmes. Si une des entités liées au job a été
+// détruite entre temps, la suite est annulée.
+
+struct JobStats
+{
+    std::uint64_t completed = 0;
+    std::uint64_t cancelled = 0;
+    double queueUs = 0.0;
+    double runUs = 0.0;
+    double totalUs = 0.0;
+    double maxTotalUs = 0.0;
+};
+
+class JobScheduler
+{
+    private:
+
+        using Clock = std::chrono::steady_clock;
+
+        struct Completion
+        {
+            const char* label;
+            std::vector<Entity> entities;
+            std::function<void(void)> resume;
+            std::function<void(void)> cancel;
+            std::uint64_t generation;
+            Clock::time_point submitted;
+            Clock::time_point started;
+            Clock::time_point finished;
+        };
+
+        std::size_t _threads;
+        std::mutex _mutex;
+        std::vector<Completion> _ready;
+        std::vector<Completion> _draining;
+        std::atomic<std::size_t> _inFlight {0};
+        std::atomic<std::uint64_t> _generation {0};
+        std::unordered_map<std::string, JobStats> _stats;
+        std::unique_ptr<ThreadPool> _pool;
+
+        static double micros(Clock::duration d)
+        {
+            return std::chrono::duration<double, std::micro>(d).count();
+        }
+
+        ThreadPool& pool(void)
+        {
+            if (!_pool)
+                _pool = std::make_unique<ThreadPool>(_threads);
+            return *_pool;
+        }
+
+        template <typename Work, typename Then>
+        void enqueue(const char* label, std::vector<Entity> entities, Work&& work, Then&& then, std::function<void(void)> cancel)
+        {
+            using Result = std::invoke_result_t<std::decay_t<Work>&>;
+            _inFlight++;
+            Clock::time_point submitted = Clock::now();
+            std::uint64_t generation = _generation;
+            pool().submit([this, label, entities = std::move(entities), work = std::forward<Work>(work), then = std::forward<Then>(then), cancel = std::move(cancel), generation, submitted]() mutable {
+                Clock::time_point started = Clock::now();
+                std::function<void(void)> resume;
+                if constexpr (std::is_void_v<Result>)
+                {
+                    work();
+                    resume = std::move(then);
+                }
+                else
+                {
+                    auto result = std::make_shared<Result>(work());
+                    resume = [then = std::move(then), result]() mutable { then(std::move(*result)); };
+                }
+                Completion done {label, std::move(entities), std::move(resume), std::move(cancel), generation, submitted, started, Clock::now()};
+                std::lock_guard<std::mutex> lock(_mutex);
+                _ready.push_back(std::move(done));
+            });
+        }
+
+    public:
+
+        explicit JobScheduler(std::size_t threads = std::thread::hardware_concurrency()) : _threads(threads) {}
+
+        virtual ~JobScheduler(void)
+        {
+            _pool.reset();
+            for (auto& c : _ready)
+            {
+                if (c.cancel)
+                    c.cancel();
+            }
+        }
+
+        JobScheduler(const JobScheduler&) = delete;
+        JobScheduler& operator=(const JobScheduler&) = delete;
+
+        // work() tourne sur un worker, then(résultat) sur le thread de simulation
+        template <typename Work, typename Then>
+        void submit(const char* label, std::vector<Entity> entities, Work&& work, Then&& then)
+        {
+            enqueue(label, std::move(entities), std::forward<Work>(work), std::forward<Then>(then), nullptr);
+        }
+
+        // Exécute les suites prêtes ; alive(Entity) décide si elles sont annulées
+        template <typename Alive>
+        std::size_t drain(Alive&& alive)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _draining.swap(_ready);
+            }
+            for (auto& c : _draining)
+            {
+                JobStats& st = _stats[c.label];
+                bool valid = c.generation == _generation && std::all_of(c.entities.begin(), c.entities.end(), [&](Entity e) { return alive(e); });
+                if (valid)
+                {
+                    c.resume();
+                    st.completed++;
+                }
+                else
+                {
+                    if (c.cancel)
+                        c.cancel();
+                    st.cancelled++;
+                }
+                double total = micros(Clock::now() - c.submitted);
+                st.queueUs += micros(c.started - c.submitted);
+                st.runUs += micros(c.finished - c.started);
+                st.totalUs += total;
+                st.maxTotalUs = std::max(st.maxTotalUs, total);
+            }
+            std::size_t count = _draining.size();
+            _inFlight -= count;
+            _draining.clear();
+            return count;
+        }
+
+        // Tous les jobs déjà soumis seront annulés à leur arrivée (ex. scène vidée)
+        void cancelPending(void)
+        {
+            _generation++;
+        }
+
+        std::size_t inFlight(void) const
+        {
+            return _inFlight;
+        }
+
+        const JobStats* stats(const std::string& label) const
+        {
+            auto it = _stats.find(label);
+            return it != _stats.end() ? &it->second : nullptr;
+        }
+
+        template <typename Func>
+        void forEachStats(Func&& fnc) const
+        {
+            for (const auto& [label, st] : _stats)
+                fnc(label, st);
+        }
+
+#if defined(__cpp_impl_coroutine)
+
+        // Awaitable : co_await jobs.async("label", {e}, work) suspend le système jusqu'au drain()
+        // qui suit la fin du travail ; si une entité liée est détruite, la coroutine est détruite.
+        template <typename Work>
+        struct Awaiter
+        {
+            using Result = std::invoke_result_t<Work&>;
+            using Storage = std::conditional_t<std::is_void_v<Result>, bool, std::optional<Result>>;
+
+            JobScheduler& jobs;
+            const char* label;
+            std::vector<Entity> entities;
+            Work work;
+            Storage result {};
+
+            bool await_ready(void) const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> handle)
+            {
+                auto cancel = [handle]() { handle.destroy(); };
+                if constexpr (std::is_void_v<Result>)
+                    jobs.enqueue(label, std::move(entities), std::move(work), [handle]() { handle.resume(); }, cancel);
+                else
+                    jobs.enqueue(label, std::move(entities), std::move(work), [this, handle](Result&& r) { result.emplace(std::move(r)); handle.resume(); }, cancel);
+            }
+
+            Result await_resume(void)
+            {
+                if constexpr (!std::is_void_v<Result>)
+                    return std::move(*result);
+            }
+        };
+
+        template <typename Work>
+        Awaiter<std::decay_t<Work>> async(const char* label, std::vector<Entity> entities, Work&& work)
+        {
+            return {*this, label, std::move(entities), std::forward<Work>(work)};
+        }
+
+        template <typename Work>
+        Awaiter<std::decay_t<Work>> async(const char* label, Entity e, Work&& work)
+        {
+            return {*this, label, std::vector<Entity>(1, e), std::forward<Work>(work)};
+        }
+
+#endif
+};
+
+#if defined(__cpp_impl_coroutine)
+
+// Coroutine lancée immédiatement, détachée : son cadre est libéré à la fin ou à l'annulation
+struct JobTask
+{
+    struct promise_type
+    {
+        JobTask get_return_object(void) { return {}; }
+        std::suspend_never initial_suspend(void) noexcept { return {}; }
+        std::suspend_never final_suspend(void) noexcept { return {}; }
+        void return_void(void) {}
+        void unhandled_exception(void) { std::terminate(); }
+    };
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,397 @@
+#pragma once
+
+#include "Bus.hpp"
+#include "RunTimeInspector.hpp"
+#include "Streaming.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// === Format du journal ===
+// En-tête (magic, format), puis une suite d'enregistrements : RecordHeader + charge utile.
+// Frame : dt et numéro de frame. Input : événement publié hors de GameManager::update, rejoué.
+// Trace : événement publié pendant une frame, conséquence de la simulation, non rejoué.
+
+namespace journal
+{
+    static constexpr std::uint32_t MAGIC = 0x4A534345; // "ECSJ"
+    static constexpr std::uint32_t FORMAT = 1;
+
+    enum class Kind : std::uint32_t
+    {
+        Frame = 1,
+        Input = 2,
+        Trace = 3
+    };
+
+    struct RecordHeader
+    {
+        Kind kind;
+        std::uint32_t size;
+        std::uint64_t tag;
+    };
+
+    // Identifiant stable d'un type d'événement entre deux builds : FNV-1a de son nom
+    template <typename T>
+    constexpr std::uint64_t tagOf(void)
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (char c : typeName<T>())
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+}
+
+struct JournalStats
+{
+    std::uint64_t frames = 0;
+    std::uint64_t records = 0;
+    std::uint64_t bytes = 0;
+    std::uint64_t stalls = 0;       // anneau plein : le producteur a attendu le thread d'écriture
+    std::uint64_t dropped = 0;      // enregistrement plus grand que l'anneau
+    std::uint64_t flushes = 0;
+    std::uint64_t bytesFlushed = 0;
+};
+
+// === EventJournal : enregistrement des événements et des dt dans un fichier binaire ===
+// Le thread de simulation copie chaque enregistrement dans un anneau pré-alloué (une copie,
+// aucune allocation après la première frame) ; un thread dédié vide l'anneau vers le fichier.
+// Seuls les types déclarés par track<T>() sont enregistrés.
+
+class EventJournal
+{
+    private:
+
+        std::vector<char> _ring;
+        std::atomic<std::uint64_t> _head {0};
+        std::atomic<std::uint64_t> _tail {0};
+        std::vector<char> _scratch;
+        std::vector<char> _payload;
+        std::vector<std::function<void(void)>> _untrack;
+        int _fd = -1;
+        bool _inFrame = false;
+        std::uint64_t _frame = 0;
+        std::uint64_t _notifiedAt = 0;
+        JournalStats _stats;
+        std::atomic<std::uint64_t> _flushes {0};
+        std::atomic<std::uint64_t> _bytesFlushed {0};
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        bool _stop = false;
+        std::thread _writer;
+
+        void wakeWriter(void)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _wake.notify_one();
+        }
+
+        void append(const char* bytes, std::size_t size)
+        {
+            std::size_t capacity = _ring.size();
+            if (size > capacity)
+            {
+                _stats.dropped++;
+                return;
+            }
+            std::uint64_t head = _head.load(std::memory_order_relaxed);
+            if (capacity - (head - _tail.load(std::memory_order_acquire)) < size)
+            {
+                _stats.stalls++;
+                while (capacity - (head - _tail.load(std::memory_order_acquire)) < size)
+                {
+                    wakeWriter();
+                    std::this_thread::yield();
+                }
+            }
+            std::size_t at = head % capacity;
+            std::size_t first = std::min(size, capacity - at);
+            std::memcpy(_ring.data() + at, bytes, first);
+            std::memcpy(_ring.data(), bytes + first, size - first);
+            _head.store(head + size, std::memory_order_release);
+            _stats.records++;
+            _stats.bytes += size;
+            if (head + size - _notifiedAt >= capacity / 2)
+            {
+                _notifiedAt = head + size;
+                wakeWriter();
+            }
+        }
+
+        void record(journal::Kind kind, std::uint64_t tag, const char* payload, std::size_t size)
+        {
+            journal::RecordHeader header {kind, static_cast<std::uint32_t>(size), tag};
+            _scratch.resize(sizeof(header) + size);
+            std::memcpy(_scratch.data(), &header, sizeof(header));
+            std::memcpy(_scratch.data() + sizeof(header), payload, size);
+            append(_scratch.data(), _scratch.size());
+        }
+
+        bool writeAll(const char* bytes, std::size_t size)
+        {
+            while (size > 0)
+            {
+                ssize_t n = ::write(_fd, bytes, size);
+                if (n <= 0)
+                    return false;
+                bytes += n;
+                size -= static_cast<std::size_t>(n);
+            }
+            return true;
+        }
+
+        // Thread d'écriture uniquement
+        void drain(void)
+        {
+            std::uint64_t tail = _tail.load(std::memory_order_relaxed);
+            std::uint64_t head = _head.load(std::memory_order_acquire);
+            if (head == tail)
+                return;
+            std::size_t capacity = _ring.size();
+            std::size_t at = tail % capacity;
+            std::size_t size = head - tail;
+            std::size_t first = std::min(size, capacity - at);
+            writeAll(_ring.data() + at, first);
+            writeAll(_ring.data(), size - first);
+            _tail.store(head, std::memory_order_release);
+            _flushes++;
+            _bytesFlushed += size;
+        }
+
+        void writerLoop(void)
+        {
+            for (;;)
+            {
+                bool stop;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _wake.wait_for(lock, std::chrono::milliseconds(5));
+                    stop = _stop;
+                }
+                drain();
+                if (stop)
+                    return;
+            }
+        }
+
+    public:
+
+        explicit EventJournal(std::size_t ringBytes = 1 << 20) : _ring(ringBytes) {}
+
+        virtual ~EventJournal(void)
+        {
+            close();
+        }
+
+        EventJournal(const EventJournal&) = delete;
+        EventJournal& operator=(const EventJournal&) = delete;
+
+        bool open(const std::string& path)
+        {
+            close();
+            _fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (_fd < 0)
+                return false;
+            std::uint32_t header[2] = {journal::MAGIC, journal::FORMAT};
+            if (!writeAll(reinterpret_cast<const char*>(header), sizeof(header)))
+            {
+                ::close(_fd);
+                _fd = -1;
+                return false;
+            }
+            _stop = false;
+            _writer = std::thread([this] { writerLoop(); });
+            return true;
+        }
+
+        bool isOpen(void) const
+        {
+            return _fd >= 0;
+        }
+
+        // Retire les enregistreurs du bus, vide l'anneau et ferme le fichier
+        void close(void)
+        {
+            for (auto& untrack : _untrack)
+                untrack();
+            _untrack.clear();
+            if (_fd < 0)
+                return;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _wake.notify_one();
+            _writer.join();
+            ::close(_fd);
+            _fd = -1;
+        }
+
+        // Enregistre chaque dispatch de T ; T sérialisé via StreamTraits<T>. Un autre journal qui
+        // suit T ensuite prend la main, et close() ne retire que l'enregistreur de ce journal
+        template <typename T>
+        void track(void)
+        {
+            static_assert(StreamTraits<T>::enabled, "journaled events need StreamTraits<T>");
+            EventBus::instance().setRecorder<T>([this](const T& event) {
+                if (_fd < 0)
+                    return;
+                _payload.clear();
+                StreamTraits<T>::write(_payload, event);
+                record(_inFrame ? journal::Kind::Trace : journal::Kind::Input, journal::tagOf<T>(), _payload.data(), _payload.size());
+            }, this);
+            _untrack.push_back([this]() { EventBus::instance().clearRecorder<T>(this); });
+        }
+
+        // Appelés par GameManager::update autour de la frame
+        void beginFrame(double dt)
+        {
+            if (_fd < 0)
+                return;
+            char payload[sizeof(double) + sizeof(std::uint64_t)];
+            std::memcpy(payload, &dt, sizeof(double));
+            std::memcpy(payload + sizeof(double), &_frame, sizeof(std::uint64_t));
+            record(journal::Kind::Frame, 0, payload, sizeof(payload));
+            _frame++;
+            _stats.frames++;
+            _inFrame = true;
+        }
+
+        void endFrame(void)
+        {
+            _inFrame = false;
+        }
+
+        JournalStats stats(void) const
+        {
+            JournalStats st = _stats;
+            st.flushes = _flushes;
+            st.bytesFlushed = _bytesFlushed;
+            return st;
+        }
+};
+
+// === JournalReplayer : rejoue un journal dans un GameManager neuf ===
+// Le jeu doit être construit à l'identique (scènes, systèmes) avant replay() ; les inputs sont
+// republiés sur l'EventBus exactement entre les mêmes frames, avec les mêmes dt.
+
+class JournalReplayer
+{
+    private:
+
+        std::vector<char> _bytes;
+        std::size_t _cursor = 0;
+        std::unordered_map<std::uint64_t, std::function<void(const char*, std::size_t)>> _decoders;
+        std::uint64_t _unknown = 0;
+        std::uint64_t _inputs = 0;
+
+    public:
+
+        bool open(const std::string& path)
+        {
+            int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+                return false;
+            struct stat st;
+            if (::fstat(fd, &st) != 0)
+            {
+                ::close(fd);
+                return false;
+            }
+            _bytes.resize(static_cast<std::size_t>(st.st_size));
+            std::size_t offset = 0;
+            while (offset < _bytes.size())
+            {
+                ssize_t n = ::read(fd, _bytes.data() + offset, _bytes.size() - offset);
+                if (n <= 0)
+                    break;
+                offset += static_cast<std::size_t>(n);
+            }
+            ::close(fd);
+            std::uint32_t header[2] = {0, 0};
+            if (offset != _bytes.size() || offset < sizeof(header))
+                return false;
+            std::memcpy(header, _bytes.data(), sizeof(header));
+            _cursor = sizeof(header);
+            return header[0] == journal::MAGIC && header[1] == journal::FORMAT;
+        }
+
+        template <typename T>
+        void track(void)
+        {
+            _decoders[journal::tagOf<T>()] = [](const char* payload, std::size_t size) {
+                T event {};
+                if (StreamTraits<T>::read(payload, payload + size, event))
+                    EventBus::instance().publish(event);
+            };
+        }
+
+        // Republie les inputs jusqu'à la prochaine frame puis la joue ; false en fin de journal
+        template <typename Game>
+        bool step(Game& game)
+        {
+            journal::RecordHeader header;
+            while (_cursor + sizeof(header) <= _bytes.size())
+            {
+                std::memcpy(&header, _bytes.data() + _cursor, sizeof(header));
+                const char* payload = _bytes.data() + _cursor + sizeof(header);
+                if (header.size > _bytes.size() - _cursor - sizeof(header))
+                    break;
+                _cursor += sizeof(header) + header.size;
+                if (header.kind == journal::Kind::Input)
+                {
+                    auto it = _decoders.find(header.tag);
+                    if (it == _decoders.end())
+                        _unknown++;
+                    else
+                    {
+                        it->second(payload, header.size);
+                        _inputs++;
+                    }
+                }
+                else if (header.kind == journal::Kind::Frame)
+                {
+                    double dt;
+                    std::memcpy(&dt, payload, sizeof(dt));
+                    game.update(dt);
+                    return true;
+                }
+            }
+            _cursor = _bytes.size();
+            return false;
+        }
+
+        template <typename Game>
+        std::size_t replay(Game& game)
+        {
+            std::size_t frames = 0;
+            while (step(game))
+                frames++;
+            return frames;
+        }
+
+        std::uint64_t inputs(void) const
+        {
+            return _inputs;
+        }
+
+        std::uint64_t unknown(void) const
+        {
+            return _unknown;
+        }
+};
\ No newline at end of file
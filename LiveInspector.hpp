@@ -0,0 +1,384 @@
+#pragma once
+
+#include "Registry.hpp"
+#include "RunTimeInspector.hpp"
+#include "System.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// === Segment d'inspection partagé (POSIX shm) ===
+// [LiveHeader][LiveComponent x componentCount][LiveSystem x systemCount][tableaux]
+// Protocole seqlock : l'écrivain rend sequence impaire, écrit, puis la rend paire. Un lecteur
+// copie le segment et ne garde la copie que si sequence était paire et inchangée : la
+// simulation n'attend jamais un lecteur, un lecteur recommence au pire sa copie.
+
+namespace live
+{
+    static constexpr std::uint32_t MAGIC = 0x4C534345; // "ECSL"
+    static constexpr std::uint32_t FORMAT = 1;
+    static constexpr std::size_t NAME_BYTES = 64;
+
+    struct Header
+    {
+        std::uint32_t magic;
+        std::uint32_t format;
+        std::atomic<std::uint64_t> sequence;
+        std::uint64_t segmentBytes;
+        std::uint64_t usedBytes;
+        std::uint64_t frame;
+        std::uint32_t entityBytes;
+        std::uint32_t componentCount;
+        std::uint32_t systemCount;
+        std::uint32_t reserved;
+    };
+
+    struct Component
+    {
+        char name[NAME_BYTES];
+        std::uint32_t elementSize;
+        std::uint32_t hasData;      // 0 : composant non trivialement copiable ou tag, entités seules
+        std::uint64_t count;
+        std::uint64_t entities;     // décalages depuis le début du segment
+        std::uint64_t data;
+    };
+
+    struct System
+    {
+        char name[NAME_BYTES];
+        std::uint64_t runs;
+        std::uint64_t skipped;
+        std::uint64_t overruns;
+        double lastUs;
+        double maxUs;
+        double totalUs;
+    };
+
+    inline std::size_t align(std::size_t offset)
+    {
+        return (offset + 7) & ~std::size_t(7);
+    }
+
+    inline void copyName(char (&dst)[NAME_BYTES], std::string_view src)
+    {
+        std::size_t n = std::min(src.size(), NAME_BYTES - 1);
+        std::memcpy(dst, src.data(), n);
+        dst[n] = '\0';
+    }
+}
+
+// === LiveInspector : publication de l'état d'un registry dans un segment partagé ===
+
+template <typename ComponentList>
+class LiveInspector;
+
+template <typename... Cs>
+class LiveInspector<TypeList<Cs...>>
+{
+    private:
+
+        std::string _name;
+        int _fd = -1;
+        unsigned char* _base = nullptr;
+        std::size_t _bytes = 0;
+        std::uint64_t _frame = 0;
+        std::uint64_t _everyNFrames = 1;
+
+        live::Header& header(void)
+        {
+            return *reinterpret_cast<live::Header*>(_base);
+        }
+
+        bool map(std::size_t bytes)
+        {
+            if (::ftruncate(_fd, static_cast<off_t>(bytes)) != 0)
+                return false;
+            void* ptr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+            if (ptr == MAP_FAILED)
+                return false;
+            if (_base)
+                ::munmap(_base, _bytes);
+            _base = static_cast<unsigned char*>(ptr);
+            _bytes = bytes;
+            return true;
+        }
+
+        template <typename T>
+        static constexpr bool hasData(void)
+        {
+            return std::is_trivially_copyable_v<T> && !std::is_empty_v<T>;
+        }
+
+        template <typename T>
+        static std::size_t payloadOf(const StorageOf<T>& pool)
+        {
+            std::size_t bytes = live::align(pool.enabledSize() * sizeof(Entity));
+            if constexpr (hasData<T>())
+                bytes += live::align(pool.enabledSize() * sizeof(T));
+            return bytes;
+        }
+
+    public:
+
+        LiveInspector(void) = default;
+
+        virtual ~LiveInspector(void)
+        {
+            close();
+        }
+
+        LiveInspector(const LiveInspector&) = delete;
+        LiveInspector& operator=(const LiveInspector&) = delete;
+
+        // name : nom POSIX du segment, ex. "/ecs-live"
+        bool open(const std::string& name, std::size_t initialBytes = 1 << 20)
+        {
+            close();
+            _fd = ::shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+            if (_fd < 0)
+                return false;
+            _name = name;
+            if (!map(std::max(initialBytes, sizeof(live::Header))))
+            {
+                close();
+                return false;
+            }
+            live::Header& h = header();
+            new (&h.sequence) std::atomic<std::uint64_t>(0);
+            h.magic = live::MAGIC;
+            h.format = live::FORMAT;
+            h.segmentBytes = _bytes;
+            h.usedBytes = sizeof(live::Header);
+            h.frame = 0;
+            h.entityBytes = sizeof(Entity);
+            h.componentCount = 0;
+            h.systemCount = 0;
+            return true;
+        }
+
+        void close(void)
+        {
+            if (_base)
+                ::munmap(_base, _bytes);
+            if (_fd >= 0)
+            {
+                ::close(_fd);
+                ::shm_unlink(_name.c_str());
+            }
+            _base = nullptr;
+            _bytes = 0;
+            _fd = -1;
+        }
+
+        void setEveryNFrames(std::uint64_t frames)
+        {
+            _everyNFrames = std::max<std::uint64_t>(frames, 1);
+        }
+
+        // Fin de frame, thread de simulation : copie les tableaux denses et les timings
+        template <typename SystemsT>
+        bool publish(const Registry<TypeList<Cs...>>& reg, const SystemsT& systems)
+        {
+            if (!_base || (_frame++ % _everyNFrames) != 0)
+                return false;
+
+            std::uint32_t systemCount = 0;
+            systems.forEachStats([&](const char*, const SystemStats&) { systemCount++; });
+            std::size_t offset = live::align(sizeof(live::Header) + sizeof...(Cs) * sizeof(live::Component) + systemCount * sizeof(live::System));
+            std::size_t needed = offset;
+            StaticForEach<TypeList<Cs...>>([&](auto tag) {
+                using T = typename decltype(tag)::type;
+                needed += payloadOf<T>(reg.template storage<T>());
+            });
+
+            // Agrandi hors section critique : un lecteur remappe en voyant segmentBytes changer
+            if (needed > _bytes && !map(needed + needed / 2))
+                return false;
+
+            live::Header& h = header();
+            std::uint64_t seq = h.sequence.load(std::memory_order_relaxed);
+            h.sequence.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            h.segmentBytes = _bytes;
+            h.usedBytes = needed;
+            h.frame = _frame - 1;
+            h.componentCount = sizeof...(Cs);
+            h.systemCount = systemCount;
+
+            auto* components = reinterpret_cast<live::Component*>(_base + sizeof(live::Header));
+            std::size_t index = 0;
+            StaticForEach<TypeList<Cs...>>([&](auto tag) {
+                using T = typename decltype(tag)::type;
+                const auto& pool = reg.template storage<T>();
+                live::Component& c = components[index++];
+                live::copyName(c.name, typeName<T>());
+                c.elementSize = sizeof(T);
+                c.hasData = hasData<T>();
+                // Seule la partition active [0, enabledSize()) est publiée, comme forEachEntityWith
+                std::size_t count = pool.enabledSize();
+                c.count = count;
+                c.entities = offset;
+                auto* entities = reinterpret_cast<Entity*>(_base + offset);
+                for (std::size_t i = 0; i < count; i++)
+                    entities[i] = pool.entityAt(i);
+                offset += live::align(count * sizeof(Entity));
+                c.data = 0;
+                if constexpr (hasData<T>())
+                {
+                    c.data = offset;
+                    for (std::size_t i = 0; i < count; i++)
+                        std::memcpy(_base + offset + i * sizeof(T), &pool.valueAt(i), sizeof(T));
+                    offset += live::align(count * sizeof(T));
+                }
+            });
+
+            auto* slots = reinterpret_cast<live::System*>(components + sizeof...(Cs));
+            index = 0;
+            systems.forEachStats([&](const char* name, const SystemStats& st) {
+                live::System& s = slots[index++];
+                live::copyName(s.name, name);
+                s.runs = st.runs;
+                s.skipped = st.skipped;
+                s.overruns = st.overruns;
+                s.lastUs = st.lastUs;
+                s.maxUs = st.maxUs;
+                s.totalUs = st.totalUs;
+            });
+
+            h.sequence.store(seq + 2, std::memory_order_release);
+            return true;
+        }
+};
+
+// === LiveFrame / LiveReader : côté moniteur, copie cohérente d'une publication ===
+
+struct LiveFrame
+{
+    std::uint64_t frame = 0;
+    std::vector<live::Component> components;
+    std::vector<live::System> systems;
+    std::vector<unsigned char> bytes;
+
+    std::size_t count(const live::Component& c) const
+    {
+        return c.count;
+    }
+
+    Entity entityAt(const live::Component& c, std::size_t index) const
+    {
+        Entity e;
+        std::memcpy(&e, bytes.data() + c.entities + index * sizeof(Entity), sizeof(Entity));
+        return e;
+    }
+
+    // Octets bruts du composant de l'entité d'id donné, nullptr si absent ou sans données
+    const unsigned char* find(const live::Component& c, std::uint32_t id) const
+    {
+        for (std::size_t i = 0; i < c.count; i++)
+        {
+            if (entityAt(c, i).id() == id)
+                return c.hasData ? bytes.data() + c.data + i * c.elementSize : nullptr;
+        }
+        return nullptr;
+    }
+};
+
+class LiveReader
+{
+    private:
+
+        int _fd = -1;
+        const unsigned char* _base = nullptr;
+        std::size_t _bytes = 0;
+
+        const live::Header& header(void) const
+        {
+            return *reinterpret_cast<const live::Header*>(_base);
+        }
+
+        bool remap(std::size_t bytes)
+        {
+            void* ptr = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, _fd, 0);
+            if (ptr == MAP_FAILED)
+                return false;
+            if (_base)
+                ::munmap(const_cast<unsigned char*>(_base), _bytes);
+            _base = static_cast<const unsigned char*>(ptr);
+            _bytes = bytes;
+            return true;
+        }
+
+    public:
+
+        LiveReader(void) = default;
+
+        virtual ~LiveReader(void)
+        {
+            if (_base)
+                ::munmap(const_cast<unsigned char*>(_base), _bytes);
+            if (_fd >= 0)
+                ::close(_fd);
+        }
+
+        LiveReader(const LiveReader&) = delete;
+        LiveReader& operator=(const LiveReader&) = delete;
+
+        bool open(const std::string& name)
+        {
+            _fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+            if (_fd < 0)
+                return false;
+            struct stat st;
+            if (::fstat(_fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(live::Header))
+                return false;
+            if (!remap(static_cast<std::size_t>(st.st_size)))
+                return false;
+            return header().magic == live::MAGIC && header().format == live::FORMAT && header().entityBytes == sizeof(Entity);
+        }
+
+        // Copie la dernière publication ; false si aucune copie cohérente en attempts essais
+        bool read(LiveFrame& out, int attempts = 64)
+        {
+            for (int i = 0; i < attempts; i++)
+            {
+                std::uint64_t before = header().sequence.load(std::memory_order_acquire);
+                if (before & 1)
+                    continue;
+                if (header().segmentBytes > _bytes)
+                {
+                    if (!remap(header().segmentBytes))
+                        return false;
+                    continue;
+                }
+                std::size_t used = header().usedBytes;
+                std::size_t componentCount = header().componentCount;
+                std::size_t systemCount = header().systemCount;
+                std::size_t tables = sizeof(live::Header) + componentCount * sizeof(live::Component) + systemCount * sizeof(live::System);
+                if (used > _bytes || tables > used)
+                    continue;
+                out.frame = header().frame;
+                out.bytes.assign(_base, _base + used);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (header().sequence.load(std::memory_order_relaxed) != before)
+                    continue;
+                const unsigned char* table = out.bytes.data() + sizeof(live::Header);
+                out.components.resize(componentCount);
+                std::memcpy(out.components.data(), table, componentCount * sizeof(live::Component));
+                out.systems.resize(systemCount);
+                std::memcpy(out.systems.data(), table + componentCount * sizeof(live::Component), systemCount * sizeof(live::System));
+                return before != 0;
+            }
+            return false;
+        }
+};
\ No newline at end of file
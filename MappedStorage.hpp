@@ -0,0 +1,509 @@
+#pragma once
+
+#include "Storage.hpp"
+#include "StringPool.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// === MappedArray : tableau de valeurs triviales dans une projection mémoire ===
+// Sans fichier, la projection est anonyme (équivalent d'un vector). Avec open(), le tableau
+// vit dans un fichier partagé : l'OS charge les pages à la demande et un processus relancé
+// retrouve le contenu tel quel si l'en-tête correspond.
+
+struct MappedHeader
+{
+    static constexpr std::uint32_t MAGIC = 0x4D534345; // "ECSM"
+    static constexpr std::uint32_t FORMAT = 1;
+    static constexpr std::size_t BYTES = 64;
+
+    std::uint32_t magic;
+    std::uint32_t format;
+    std::uint32_t elementSize;
+    std::uint32_t schema;
+    std::uint64_t count;
+    std::uint64_t capacity;
+};
+
+template <typename U>
+class MappedArray
+{
+    private:
+
+        static_assert(std::is_trivially_copyable_v<U>, "MappedArray requires a trivially copyable type");
+        static_assert(alignof(U) <= MappedHeader::BYTES && sizeof(MappedHeader) <= MappedHeader::BYTES);
+
+        int _fd = -1;
+        unsigned char* _base = nullptr;
+        std::size_t _bytes = 0;
+        std::uint32_t _schema = 0;
+
+        static std::size_t bytesFor(std::size_t capacity)
+        {
+            return MappedHeader::BYTES + capacity * sizeof(U);
+        }
+
+        static unsigned char* map(int fd, std::size_t bytes)
+        {
+            int flags = fd >= 0 ? MAP_SHARED : MAP_PRIVATE | MAP_ANONYMOUS;
+            void* ptr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, fd, 0);
+            return ptr == MAP_FAILED ? nullptr : static_cast<unsigned char*>(ptr);
+        }
+
+        // Plus de mémoire projetable : même traitement qu'un échec d'allocation
+        static void fail(const char* what)
+        {
+            std::cerr << "[MappedArray] " << what << " failed: " << std::strerror(errno) << std::endl;
+            std::abort();
+        }
+
+        MappedHeader& header(void) const
+        {
+            return *reinterpret_cast<MappedHeader*>(_base);
+        }
+
+        void release(void)
+        {
+            if (_base)
+                ::munmap(_base, _bytes);
+            if (_fd >= 0)
+                ::close(_fd);
+            _base = nullptr;
+            _bytes = 0;
+            _fd = -1;
+        }
+
+        void initHeader(std::size_t capacity)
+        {
+            header() = MappedHeader {MappedHeader::MAGIC, MappedHeader::FORMAT, static_cast<std::uint32_t>(sizeof(U)), _schema, 0, capacity};
+        }
+
+        bool valid(std::size_t fileBytes) const
+        {
+            const MappedHeader& h = header();
+            return h.magic == MappedHeader::MAGIC && h.format == MappedHeader::FORMAT && h.elementSize == sizeof(U)
+                && h.schema == _schema && h.count <= h.capacity && bytesFor(h.capacity) <= fileBytes;
+        }
+
+    public:
+
+        explicit MappedArray(std::uint32_t schema = 0) : _schema(schema) {}
+
+        virtual ~MappedArray(void)
+        {
+            release();
+        }
+
+        MappedArray(const MappedArray&) = delete;
+        MappedArray& operator=(const MappedArray&) = delete;
+
+        // Rattache le tableau à path ; un en-tête absent ou différent repart d'un tableau vide.
+        // En cas d'échec, le tableau courant est conservé et false est renvoyé.
+        bool open(const std::string& path)
+        {
+            int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+            if (fd < 0)
+                return false;
+            struct stat st;
+            if (::fstat(fd, &st) != 0)
+            {
+                ::close(fd);
+                return false;
+            }
+            std::size_t fileBytes = static_cast<std::size_t>(st.st_size);
+            bool fresh = fileBytes < MappedHeader::BYTES;
+            if (fresh)
+            {
+                fileBytes = bytesFor(0);
+                if (::ftruncate(fd, static_cast<off_t>(fileBytes)) != 0)
+                {
+                    ::close(fd);
+                    return false;
+                }
+            }
+            unsigned char* base = map(fd, fileBytes);
+            if (!base)
+            {
+                ::close(fd);
+                return false;
+            }
+            release();
+            _fd = fd;
+            _base = base;
+            _bytes = fileBytes;
+            if (fresh || !valid(fileBytes))
+                initHeader((fileBytes - MappedHeader::BYTES) / sizeof(U));
+            return true;
+        }
+
+        bool isMapped(void) const
+        {
+            return _fd >= 0;
+        }
+
+        // Échange les projections : permet d'ouvrir dans un temporaire puis de basculer
+        void swap(MappedArray& other)
+        {
+            std::swap(_fd, other._fd);
+            std::swap(_base, other._base);
+            std::swap(_bytes, other._bytes);
+            std::swap(_schema, other._schema);
+        }
+
+        void reserve(std::size_t capacity)
+        {
+            std::size_t current = _base ? header().capacity : 0;
+            if (capacity <= current)
+                return;
+            capacity = std::max<std::size_t>({capacity, current * 2, 64});
+            std::size_t bytes = bytesFor(capacity);
+            if (_fd >= 0)
+            {
+                if (::ftruncate(_fd, static_cast<off_t>(bytes)) != 0)
+                    fail("ftruncate");
+                ::munmap(_base, _bytes);
+                _base = map(_fd, bytes);
+                if (!_base)
+                    fail("mmap");
+            }
+            else
+            {
+                unsigned char* base = map(-1, bytes);
+                if (!base)
+                    fail("mmap");
+                if (_base)
+                {
+                    std::memcpy(base, _base, bytesFor(header().count));
+                    ::munmap(_base, _bytes);
+                }
+                _base = base;
+                if (current == 0)
+                    initHeader(capacity);
+            }
+            _bytes = bytes;
+            header().capacity = capacity;
+        }
+
+        std::size_t size(void) const
+        {
+            return _base ? header().count : 0;
+        }
+
+        U* data(void)
+        {
+            return reinterpret_cast<U*>(_base + MappedHeader::BYTES);
+        }
+
+        const U* data(void) const
+        {
+            return reinterpret_cast<const U*>(_base + MappedHeader::BYTES);
+        }
+
+        U& operator[](std::size_t index)
+        {
+            return data()[index];
+        }
+
+        const U& operator[](std::size_t index) const
+        {
+            return data()[index];
+        }
+
+        void push_back(const U& value)
+        {
+            reserve(size() + 1);
+            data()[header().count++] = value;
+        }
+
+        void pop_back(void)
+        {
+            header().count--;
+        }
+
+        void resize(std::size_t count, const U& fill)
+        {
+            reserve(count);
+            for (std::size_t i = size(); i < count; i++)
+                data()[i] = fill;
+            if (_base)
+                header().count = count;
+        }
+
+        void append(const U* values, std::size_t count)
+        {
+            reserve(size() + count);
+            std::memcpy(data() + size(), values, count * sizeof(U));
+            header().count += count;
+        }
+
+        void clear(void)
+        {
+            if (_base)
+                header().count = 0;
+        }
+
+        // Force l'écriture des pages modifiées sur disque
+        void sync(void)
+        {
+            if (_fd >= 0)
+                ::msync(_base, _bytes, MS_SYNC);
+        }
+};
+
+// === MappedComponentStorage : sparse set dont les trois tableaux sont projetés ===
+// Même interface que ComponentStorage, réservé aux composants trivialement copiables sans
+// InternedFields.
+// Schema est la version du composant : la changer invalide les fichiers existants.
+// Après attach(), Registry::reattach<T>() réenregistre les entités retrouvées.
+
+template <typename T, std::uint32_t Schema = 1>
+class MappedComponentStorage
+{
+    private:
+
+        static_assert(std::is_trivially_copyable_v<T>, "MappedComponentStorage requires a trivially copyable component");
+        static_assert(std::is_trivially_copyable_v<Entity>);
+        static_assert(!hasInternedFields<T>, "MappedComponentStorage cannot persist InternedString handles: the StringPool is not mapped");
+
+        static constexpr std::uint64_t INVALID = ~std::uint64_t(0);
+        MappedArray<std::uint64_t> sparse {Schema};
+        MappedArray<Entity> denseEntities {Schema};
+        MappedArray<T> denseData {Schema};
+        std::size_t enabled = 0;
+
+        void ensure(const std::size_t& id)
+        {
+            if (id >= sparse.size())
+                sparse.resize(id + 1, INVALID);
+        }
+
+        void swapSlots(std::size_t a, std::size_t b)
+        {
+            if (a == b)
+                return;
+            std::swap(denseEntities[a], denseEntities[b]);
+            std::swap(denseData[a], denseData[b]);
+            sparse[denseEntities[a].id()] = a;
+            sparse[denseEntities[b].id()] = b;
+        }
+
+        void fill(std::size_t index, std::size_t from)
+        {
+            if (index == from)
+                return;
+            denseEntities[index] = denseEntities[from];
+            denseData[index] = denseData[from];
+            sparse[denseEntities[index].id()] = index;
+        }
+
+        void ensureAll(const Entity* entities, std::size_t count)
+        {
+            std::uint32_t maxId = 0;
+            for (std::size_t i = 0; i < count; i++)
+                maxId = std::max(maxId, entities[i].id());
+            ensure(maxId);
+        }
+
+        // Le sparse est recalculé depuis les entités denses : un fichier .sparse périmé ou tronqué
+        // ne peut pas faire lire hors des tableaux. false si un id apparaît deux fois.
+        bool rebuildSparse(void)
+        {
+            sparse.clear();
+            for (std::size_t i = 0; i < denseEntities.size(); i++)
+            {
+                Entity e = denseEntities[i];
+                ensure(e.id());
+                if (sparse[e.id()] != INVALID)
+                    return false;
+                sparse[e.id()] = i;
+            }
+            return true;
+        }
+
+        std::size_t enableAppended(const Entity* entities, std::size_t base, std::size_t count)
+        {
+            for (std::size_t i = 0; i < count; i++)
+                sparse[entities[i].id()] = base + i;
+            std::size_t first = enabled;
+            if (first != base)
+            {
+                std::rotate(denseEntities.data() + first, denseEntities.data() + base, denseEntities.data() + denseEntities.size());
+                std::rotate(denseData.data() + first, denseData.data() + base, denseData.data() + denseData.size());
+                for (std::size_t i = first; i < denseEntities.size(); i++)
+                    sparse[denseEntities[i].id()] = i;
+            }
+            enabled += count;
+            return first;
+        }
+
+    public:
+
+        virtual ~MappedComponentStorage(void) = default;
+
+        // Rattache le storage aux fichiers base.sparse, base.entities et base.data ;
+        // le contenu courant est remplacé par celui des fichiers. Tout ou rien : si l'un des
+        // trois ne s'ouvre pas, le storage reste sur ses tableaux actuels. L'état désactivé
+        // n'est pas persisté : toutes les entités rechargées sont actives.
+        bool attach(const std::string& base)
+        {
+            MappedArray<std::uint64_t> nextSparse {Schema};
+            MappedArray<Entity> nextEntities {Schema};
+            MappedArray<T> nextData {Schema};
+            if (!nextSparse.open(base + ".sparse") || !nextEntities.open(base + ".entities") || !nextData.open(base + ".data"))
+                return false;
+            sparse.swap(nextSparse);
+            denseEntities.swap(nextEntities);
+            denseData.swap(nextData);
+            if (denseEntities.size() != denseData.size() || !rebuildSparse())
+                clear();
+            enabled = denseEntities.size();
+            return true;
+        }
+
+        bool isMapped(void) const
+        {
+            return denseData.isMapped();
+        }
+
+        void sync(void)
+        {
+            sparse.sync();
+            denseEntities.sync();
+            denseData.sync();
+        }
+
+        bool has(Entity e) const
+        {
+            return e.id() < sparse.size() && sparse[e.id()] != INVALID && denseEntities[sparse[e.id()]].id() == e.id();
+        }
+
+        T& emplace(Entity e, const T& value)
+        {
+            ensure(e.id());
+            if (!has(e))
+            {
+                sparse[e.id()] = denseData.size();
+                denseEntities.push_back(e);
+                denseData.push_back(value);
+                swapSlots(denseData.size() - 1, enabled++);
+                return denseData[sparse[e.id()]];
+            }
+            denseData[sparse[e.id()]] = value;
+            return get(e);
+        }
+
+        void remove(Entity e)
+        {
+            if (!has(e))
+                return;
+            std::size_t index = sparse[e.id()];
+            if (index < enabled)
+            {
+                fill(index, --enabled);
+                index = enabled;
+            }
+            fill(index, denseData.size() - 1);
+            denseEntities.pop_back();
+            denseData.pop_back();
+            sparse[e.id()] = INVALID;
+        }
+
+        T& get(Entity e)
+        {
+            return denseData[sparse[e.id()]];
+        }
+
+        const T& get(Entity e) const
+        {
+            return denseData[sparse[e.id()]];
+        }
+
+        std::vector<Entity> entities(void) const
+        {
+            return std::vector<Entity>(denseEntities.data(), denseEntities.data() + denseEntities.size());
+        }
+
+        std::size_t size(void) const
+        {
+            return denseEntities.size();
+        }
+
+        std::size_t enabledSize(void) const
+        {
+            return enabled;
+        }
+
+        bool isEnabled(Entity e) const
+        {
+            return has(e) && sparse[e.id()] < enabled;
+        }
+
+        void setEnabled(Entity e, bool on)
+        {
+            if (!has(e) || isEnabled(e) == on)
+                return;
+            if (on)
+                swapSlots(sparse[e.id()], enabled++);
+            else
+                swapSlots(sparse[e.id()], --enabled);
+        }
+
+        Entity entityAt(std::size_t index) const
+        {
+            return denseEntities[index];
+        }
+
+        const T& valueAt(std::size_t index) const
+        {
+            return denseData[index];
+        }
+
+        T& valueAt(std::size_t index)
+        {
+            return denseData[index];
+        }
+
+        void clear(void)
+        {
+            sparse.clear();
+            denseEntities.clear();
+            denseData.clear();
+            enabled = 0;
+        }
+
+        std::size_t appendBulk(const Entity* entities, std::size_t count, const T& value)
+        {
+            std::size_t base = denseData.size();
+            if (count == 0)
+                return base;
+            ensureAll(entities, count);
+            denseEntities.append(entities, count);
+            denseData.resize(base + count, value);
+            return enableAppended(entities, base, count);
+        }
+
+        // Composant trivial : chaque valeur est recopiée depuis source(i), une seule réservation
+        template <typename Source>
+        std::size_t appendMoved(const Entity* entities, std::size_t count, Source&& source)
+        {
+            std::size_t base = denseData.size();
+            if (count == 0)
+                return base;
+            ensureAll(entities, count);
+            denseEntities.append(entities, count);
+            denseData.reserve(base + count);
+            for (std::size_t i = 0; i < count; i++)
+                denseData.push_back(source(i));
+            return enableAppended(entities, base, count);
+        }
+};
\ No newline at end of file
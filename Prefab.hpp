@@ -0,0 +1,29 @@
+#pragma once
+
+#include "TypeList.hpp"
+#include <tuple>
+
+// === Prefab : jeu de composants et valeurs par défaut capturés une fois ===
+
+template <typename... Ts>
+struct Prefab
+{
+    using Components = TypeList<Ts...>;
+
+    std::tuple<Ts...> values;
+
+    Prefab(void) = default;
+    explicit Prefab(const Ts&... defaults) : values(defaults...) {}
+
+    template <typename T>
+    T& get(void)
+    {
+        return std::get<T>(values);
+    }
+
+    template <typename T>
+    const T& get(void) const
+    {
+        return std::get<T>(values);
+    }
+};
@@ -3,9 +3,110 @@
 #include "TypeList.hpp"
 #include "Storage.hpp"
 #include "GroupTs.hpp"
+#include "Prefab.hpp"
+#include "Hierarchy.hpp"
+#include "StringPool.hpp"
 #include <algorithm>
+#include <array>
 #include <iostream>
 #include <tuple>
+#include <chrono>
+#include <utility>
+#include <vector>
+
+// === SliceCursor : itération reprenable sous budget de temps ===
+
+struct SliceCursor
+{
+    std::size_t next = 0;
+    std::size_t checkEvery = 64;
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+
+    bool expired(void) const
+    {
+        return std::chrono::steady_clock::now() >= deadline;
+    }
+};
+
+// === ComponentObserver : notifications d'ajout, de retrait et d'accès mutable ===
+
+template <typename T>
+struct ComponentObserver
+{
+    virtual ~ComponentObserver(void) = default;
+    virtual void onAdd(Entity, const T&) {}
+    virtual void onRemove(Entity, const T&) {}
+    // Appelé avant l'écriture : l'observateur relit la valeur plus tard
+    virtual void onPatch(Entity) {}
+    // Registry::clear() : tout le storage a été vidé d'un coup
+    virtual void onClear(void) {}
+};
+
+// === ComponentMask : signature compacte des composants d'une entité ===
+
+template <std::size_t N>
+struct ComponentMask
+{
+    static constexpr std::size_t WORDS = N == 0 ? 1 : (N + 63) / 64;
+    std::uint64_t words[WORDS] = {};
+
+    constexpr void set(std::size_t i) { words[i / 64] |= (std::uint64_t(1) << (i % 64)); }
+    constexpr void reset(std::size_t i) { words[i / 64] &= ~(std::uint64_t(1) << (i % 64)); }
+    constexpr bool test(std::size_t i) const { return (words[i / 64] >> (i % 64)) & 1; }
+
+    constexpr bool containsAll(const ComponentMask& required) const
+    {
+        for (std::size_t w = 0; w < WORDS; w++)
+        {
+            if ((words[w] & required.words[w]) != required.words[w])
+                return false;
+        }
+        return true;
+    }
+
+    // fnc(indice) pour chaque bit levé, les mots nuls sont sautés d'un coup
+    template <typename Func>
+    constexpr void forEachSet(Func&& fnc) const
+    {
+        for (std::size_t w = 0; w < WORDS; w++)
+        {
+            for (std::uint64_t bits = words[w]; bits; bits &= bits - 1)
+                fnc(w * 64 + lowestBit(bits));
+        }
+    }
+
+    static constexpr std::size_t lowestBit(std::uint64_t bits)
+    {
+#if defined(__clang__) || defined(__GNUC__)
+        return static_cast<std::size_t>(__builtin_ctzll(bits));
+#else
+        std::size_t i = 0;
+        while (!((bits >> i) & 1))
+            i++;
+        return i;
+#endif
+    }
+
+    constexpr bool none(void) const
+    {
+        for (std::size_t w = 0; w < WORDS; w++)
+        {
+            if (words[w])
+                return false;
+        }
+        return true;
+    }
+
+    constexpr bool operator==(const ComponentMask& other) const
+    {
+        for (std::size_t w = 0; w < WORDS; w++)
+        {
+            if (words[w] != other.words[w])
+                return false;
+        }
+        return true;
+    }
+};
 
 // === Registry ===
 
@@ -17,19 +118,156 @@ class Registry<TypeList<Cs...>>
 {
     private:
 
+        template <typename>
+        friend class Registry;
+
         EntityManager _manager;
-        std::tuple<ComponentStorage<Cs>...> _storages;
+        IndexedTuple<StorageOf<Cs>...> _storages;
+        IndexedTuple<std::vector<ComponentObserver<Cs>*>...> _observers;
+        std::vector<ComponentMask<sizeof...(Cs)>> _masks;
+        ComponentMask<sizeof...(Cs)> _dirtyStorages;
+        HierarchyStorage _hierarchy;
+        std::vector<Entity> _doomed;
+        std::vector<std::uint8_t> _disabled;
+        StringPool _strings;
+
+        template <typename T>
+        std::vector<ComponentObserver<T>*>& observers(void)
+        {
+            return slotAt<componentId<T>()>(_observers);
+        }
+
+        // Accès interne sans marquage : les mutations appellent touch<T>() explicitement
+        template <typename T>
+        StorageOf<T>& pool(void)
+        {
+            return slotAt<componentId<T>()>(_storages);
+        }
+
+        template <typename T>
+        void touch(void)
+        {
+            _dirtyStorages.set(componentId<T>());
+        }
+
+        template <typename T>
+        void markComponent(Entity e)
+        {
+            if (e.id() >= _masks.size())
+                _masks.resize(e.id() + 1);
+            _masks[e.id()].set(componentId<T>());
+        }
+
+        template <typename... Ts>
+        static constexpr ComponentMask<sizeof...(Cs)> maskOfImpl(TypeList<Ts...>)
+        {
+            ComponentMask<sizeof...(Cs)> m {};
+            (m.set(IndexOf<Ts, TypeList<Cs...>>::value), ...);
+            return m;
+        }
+
+        template <typename T>
+        static std::size_t storageEnabledSize(const Registry& reg)
+        {
+            return reg.template storage<T>().enabledSize();
+        }
+
+        template <typename T>
+        static Entity storageEntityAt(const Registry& reg, std::size_t index)
+        {
+            return reg.template storage<T>().entityAt(index);
+        }
+
+        template <typename Hook, std::size_t... Is, typename... Ts>
+        void instantiateHook(Entity e, std::size_t i, Hook& hook, const std::size_t* bases, std::index_sequence<Is...>, TypeList<Ts...>)
+        {
+            hook(i, e, pool<Ts>().valueAt(bases[Is] + i)...);
+            (notifyAdd<Ts>(e, pool<Ts>().valueAt(bases[Is] + i)), ...);
+        }
+
+        // Opérations effacées par composant, indexées par componentId : destroy() et
+        // setEnabled() n'appellent que les storages portés par l'entité
+        struct ErasedOps
+        {
+            void (*remove)(Registry&, Entity);
+            void (*setEnabled)(Registry&, Entity, bool);
+        };
+
+        template <typename T>
+        static void removeErased(Registry& reg, Entity e)
+        {
+            reg.remove<T>(e);
+        }
+
+        template <typename T>
+        static void setEnabledErased(Registry& reg, Entity e, bool on)
+        {
+            reg.touch<T>();
+            reg.pool<T>().setEnabled(e, on);
+        }
+
+        static const ErasedOps& erased(std::size_t id)
+        {
+            static constexpr std::array<ErasedOps, sizeof...(Cs)> table {ErasedOps {&removeErased<Cs>, &setEnabledErased<Cs>}...};
+            return table[id];
+        }
+
+        template <typename T>
+        void releaseInterned(const T& value)
+        {
+            forEachInterned(value, [&](InternedString text) { _strings.release(text); });
+        }
+
+        // Ne rend que les handles de previous que stored ne reprend pas : une lecture-
+        // modification-écriture du composant garde ses références intactes
+        template <typename T>
+        void releaseReplaced(const InternedHandles<T>& previous, const T& stored)
+        {
+            InternedHandles<T> kept = internedHandles(stored);
+            for (InternedString old : previous)
+            {
+                auto it = std::find(kept.begin(), kept.end(), old);
+                if (it != kept.end())
+                    *it = InternedString {};
+                else
+                    _strings.release(old);
+            }
+        }
+
+        template <typename T>
+        void notifyAdd(Entity e, const T& value)
+        {
+            for (auto* obs : observers<T>())
+                obs->onAdd(e, value);
+        }
+
+        template <typename T>
+        void notifyPatch(Entity e)
+        {
+            for (auto* obs : observers<T>())
+                obs->onPatch(e);
+        }
 
         template <typename ComponentList, typename Func>
         struct ApplyWithImpl;
 
+        // Les composants vides (tags) filtrent la requête mais ne sont pas passés à fnc
+        template <typename T>
+        auto componentArg(Entity e)
+        {
+            if constexpr (std::is_empty_v<T>)
+                return std::tuple<>{};
+            else
+                return std::tuple<T&>(get<T>(e));
+        }
+
         template <typename... Ts, typename Func>
         struct ApplyWithImpl<TypeList<Ts...>, Func>
         {
             template <typename RegistryT>
             static void apply(RegistryT& reg, Entity e, Func&& fnc)
             {
-                fnc(e, reg.template get<Ts>(e)...);
+                std::apply([&](auto&... comps) { fnc(e, comps...); }, std::tuple_cat(reg.template componentArg<Ts>(e)...));
             }
         };
 
@@ -48,6 +286,19 @@ class Registry<TypeList<Cs...>>
     public:
 
         using ComponentTypes = TypeList<Cs...>;
+        using Mask = ComponentMask<sizeof...(Cs)>;
+
+        template <typename T>
+        static constexpr std::size_t componentId(void)
+        {
+            return IndexOf<T, ComponentTypes>::value;
+        }
+
+        template <typename ComponentList>
+        static constexpr Mask maskOf(void)
+        {
+            return maskOfImpl(ComponentList{});
+        }
 
         virtual ~Registry(void) = default;
 
@@ -55,11 +306,84 @@ class Registry<TypeList<Cs...>>
 
         void destroy(Entity e) 
         {
+            mask(e).forEachSet([&](std::size_t id) {
+                erased(id).remove(*this, e);
+            });
+            if (e.id() < _masks.size())
+                _masks[e.id()] = Mask {};
+            if (e.id() < _disabled.size())
+                _disabled[e.id()] = 0;
+            _hierarchy.erase(e);
+            _manager.destroy(e);
+        }
+
+        // Détruit root et toute sa descendance : une passe par storage sur le bloc du sous-arbre
+        void destroyRecursive(Entity root)
+        {
+            if (!_hierarchy.contains(root))
+            {
+                destroy(root);
+                return;
+            }
+            EntityRange block = _hierarchy.subtree(root);
+            _doomed.assign(block.begin(), block.end());
+            _hierarchy.eraseSubtree(root);
             StaticForEach<ComponentTypes>([&](auto tag) {
                 using T = typename decltype(tag)::type;
-                storage<T>().remove(e);
+                for (Entity e : _doomed)
+                    remove<T>(e);
+            });
+            for (Entity e : _doomed)
+            {
+                if (e.id() < _masks.size())
+                    _masks[e.id()] = Mask {};
+                if (e.id() < _disabled.size())
+                    _disabled[e.id()] = 0;
+                _manager.destroy(e);
+            }
+            _doomed.clear();
+        }
+
+        // parent == INVALID_ENTITY : child redevient une racine
+        bool setParent(Entity child, Entity parent)
+        {
+            if (parent == INVALID_ENTITY)
+            {
+                _hierarchy.detach(child);
+                return true;
+            }
+            return _hierarchy.attach(child, parent);
+        }
+
+        Entity parentOf(Entity e) const
+        {
+            return _hierarchy.parentOf(e);
+        }
+
+        const HierarchyStorage& hierarchy(void) const
+        {
+            return _hierarchy;
+        }
+
+        // Chaînes et blobs des composants : handles InternedString propres à ce registry
+        StringPool& strings(void)
+        {
+            return _strings;
+        }
+
+        const StringPool& strings(void) const
+        {
+            return _strings;
+        }
+
+        // Propagation parent -> enfant en un parcours : fnc(const T& parent, T& enfant)
+        template <typename T, typename Func>
+        void propagate(Func&& fnc)
+        {
+            _hierarchy.forEachDepthFirst([&](Entity e, Entity parent) {
+                if (parent != INVALID_ENTITY && has<T>(e) && has<T>(parent))
+                    fnc(std::as_const(pool<T>()).get(parent), get<T>(e));
             });
-            _manager.destroy(e);
         }
 
         std::vector<Entity> getAliveEntities(void)
@@ -67,22 +391,131 @@ class Registry<TypeList<Cs...>>
             return _manager.getAliveEntities();
         }
 
+        bool valid(Entity e) const
+        {
+            return _manager.isAlive(e);
+        }
+
+        // Entité endormie : ses composants restent en place mais sortent du préfixe actif de
+        // chaque storage, les requêtes ne la visitent plus. Un échange par composant porté.
+        void disable(Entity e)
+        {
+            setEnabled(e, false);
+        }
+
+        void enable(Entity e)
+        {
+            setEnabled(e, true);
+        }
+
+        void setEnabled(Entity e, bool on)
+        {
+            if (isEnabled(e) == on)
+                return;
+            if (e.id() >= _disabled.size())
+                _disabled.resize(e.id() + 1, 0);
+            _disabled[e.id()] = !on;
+            mask(e).forEachSet([&](std::size_t id) {
+                erased(id).setEnabled(*this, e, on);
+            });
+        }
+
+        bool isEnabled(Entity e) const
+        {
+            return e.id() >= _disabled.size() || !_disabled[e.id()];
+        }
+
+        // Les InternedFields de value appartiennent désormais au composant ; ceux d'un
+        // composant remplacé sont relâchés après l'écriture, sauf s'il les reprend
         template <typename T>
         void add(Entity e, T&& value) 
         {
-            storage<T>().emplace(e, std::forward<T>(value));
+            markComponent<T>(e);
+            touch<T>();
+            bool existed = pool<T>().has(e);
+            InternedHandles<T> previous {};
+            if constexpr (hasInternedFields<T>)
+            {
+                if (existed)
+                    previous = internedHandles(pool<T>().get(e));
+            }
+            if (existed)
+                notifyPatch<T>(e);
+            const T& stored = pool<T>().emplace(e, std::forward<T>(value));
+            if (!isEnabled(e))
+                pool<T>().setEnabled(e, false);
+            if constexpr (hasInternedFields<T>)
+            {
+                if (existed)
+                    releaseReplaced(previous, stored);
+            }
+            if (!existed)
+            {
+                for (auto* obs : observers<T>())
+                    obs->onAdd(e, stored);
+            }
+        }
+
+        // Crée count entités depuis le prefab, ajoutées à la fin de out ; hook(i, e, Ts&...)
+        // est appelé pour chaque instance après la copie en bloc des valeurs par défaut
+        template <typename... Ts, typename Hook>
+        void instantiate(const Prefab<Ts...>& prefab, std::size_t count, std::vector<Entity>& out, Hook&& hook)
+        {
+            std::size_t first = out.size();
+            _manager.createMany(count, out);
+            count = out.size() - first;
+            const Entity* created = out.data() + first;
+
+            constexpr Mask prefabMask = maskOf<TypeList<Ts...>>();
+            for (std::size_t i = 0; i < count; i++)
+            {
+                if (created[i].id() >= _masks.size())
+                    _masks.resize(created[i].id() + 1);
+                _masks[created[i].id()] = prefabMask;
+            }
+
+            std::size_t bases[] = {pool<Ts>().appendBulk(created, count, prefab.template get<Ts>())...};
+            (touch<Ts>(), ...);
+            (forEachInterned(prefab.template get<Ts>(), [&](InternedString text) { _strings.retain(text, static_cast<std::uint32_t>(count)); }), ...);
+            for (std::size_t i = 0; i < count; i++)
+                instantiateHook(created[i], i, hook, bases, std::index_sequence_for<Ts...>{}, TypeList<Ts...>{});
+        }
+
+        template <typename... Ts>
+        void instantiate(const Prefab<Ts...>& prefab, std::size_t count, std::vector<Entity>& out)
+        {
+            instantiate(prefab, count, out, [](std::size_t, Entity, Ts&...) {});
         }
 
         template <typename T>
         bool has(Entity e) const 
         {
-            return storage<T>().has(e);
+            return e.id() < _masks.size() && _masks[e.id()].test(componentId<T>());
+        }
+
+        Mask mask(Entity e) const
+        {
+            return e.id() < _masks.size() ? _masks[e.id()] : Mask {};
+        }
+
+        // Storages modifiés depuis le dernier clearDirtyStorages()
+        const Mask& dirtyStorages(void) const
+        {
+            return _dirtyStorages;
+        }
+
+        void clearDirtyStorages(void)
+        {
+            _dirtyStorages = Mask {};
         }
 
         template <typename T>
         T& get(Entity e) 
         {
-            return storage<T>().get(e);
+            if (!observers<T>().empty())
+                notifyPatch<T>(e);
+            touch<T>();
+            return pool<T>().get(e);
         }
 
         template <typename T>
@@ -94,34 +527,57 @@ class Registry<TypeList<Cs...>>
         template <typename T>
         void remove(Entity e)
         {
-            storage<T>().remove(e);
+            if (!pool<T>().has(e))
+                return;
+            for (auto* obs : observers<T>())
+                obs->onRemove(e, pool<T>().get(e));
+            releaseInterned(pool<T>().get(e));
+            touch<T>();
+            pool<T>().remove(e);
+            if (e.id() < _masks.size())
+                _masks[e.id()].reset(componentId<T>());
         }
 
         template <typename T>
         T* getIf(Entity e)
         {
-            if (!storage<T>().has(e))
+            if (!has<T>(e))
                 return nullptr;
-            return &storage<T>().get(e);
+            return &get<T>(e);
         }
 
         template <typename T>
-        ComponentStorage<T>& storage(void) 
+        void connect(ComponentObserver<T>* obs)
         {
-            return std::get<ComponentStorage<T>>(_storages);
+            observers<T>().push_back(obs);
         }
 
         template <typename T>
-        const ComponentStorage<T>& storage(void) const 
+        void disconnect(ComponentObserver<T>* obs)
         {
-            return std::get<ComponentStorage<T>>(_storages);
+            auto& list = observers<T>();
+            list.erase(std::remove(list.begin(), list.end(), obs), list.end());
         }
 
+        // L'accès mutable au storage le marque modifié pour la prochaine publication
+        template <typename T>
+        StorageOf<T>& storage(void) 
+        {
+            touch<T>();
+            return pool<T>();
+        }
 
         template <typename T>
-        T* getIf(Entity e) const
+        const StorageOf<T>& storage(void) const 
         {
-            if (!storage<T>().has(e))
+            return slotAt<componentId<T>()>(_storages);
+        }
+
+
+        template <typename T>
+        const T* getIf(Entity e) const
+        {
+            if (!has<T>(e))
                 return nullptr;
             return &storage<T>().get(e);
         }
@@ -129,13 +585,13 @@ class Registry<TypeList<Cs...>>
         template <typename ComponentList>
         bool hasAll(Entity e) const
         {
-            bool result = true;
-            StaticForEach<ComponentList>([&](auto tag) 
-            {
-                using T = typename decltype(tag)::type;
-                result &= this->template has<T>(e);
-            });
-            return result;
+            constexpr Mask required = maskOf<ComponentList>();
+            return e.id() < _masks.size() && _masks[e.id()].containsAll(required);
+        }
+
+        bool hasAll(Entity e, const Mask& required) const
+        {
+            return e.id() < _masks.size() && _masks[e.id()].containsAll(required);
         }
 
         void preAllocate(std::size_t count)
@@ -148,23 +604,255 @@ class Registry<TypeList<Cs...>>
             _manager.reset();
         }
 
+        // Réenregistre les entités d'un storage rechargé (ex. MappedComponentStorage::attach) :
+        // handles, masques et observateurs ; à appeler pour chaque storage rattaché. Les entités
+        // retrouvées sont actives, comme dans le storage
+        template <typename T>
+        std::size_t reattach(void)
+        {
+            auto& store = pool<T>();
+            for (std::size_t i = 0; i < store.size(); i++)
+            {
+                Entity e = store.entityAt(i);
+                _manager.adopt(e);
+                markComponent<T>(e);
+                if (!isEnabled(e))
+                    setEnabled(e, true);
+                notifyAdd<T>(e, store.valueAt(i));
+            }
+            _manager.rebuildFree();
+            touch<T>();
+            return store.size();
+        }
+
+        // Déplace entities vers target (autre scène, autre liste de composants) : nouveaux
+        // handles, puis un transfert en bloc par storage, une réservation et un seul déplacement
+        // par valeur depuis le storage source, InternedFields réinternés dans target. Chaque
+        // entité source est ensuite retirée par un swap-remove (le dernier élément comble le trou).
+        // L'état actif et les liens de parenté internes au lot sont conservés, les entités source
+        // sont ensuite détruites ; les composants hors ComponentList disparaissent avec elles.
+        // Renvoie les paires (ancien, nouveau) dans l'ordre de entities, sans les handles
+        // invalides ni les doublons.
+        template <typename ComponentList = ComponentTypes, typename TargetList>
+        std::vector<std::pair<Entity, Entity>> migrate(const std::vector<Entity>& entities, Registry<TargetList>& target)
+        {
+            static_assert(ContainsAll<ComponentList, ComponentTypes>::value, "migrate: component missing from the source registry");
+            static_assert(ContainsAll<ComponentList, TargetList>::value, "migrate: component missing from the target registry");
+
+            constexpr std::size_t NONE = static_cast<std::size_t>(-1);
+            std::vector<std::pair<Entity, Entity>> mapping;
+            if (static_cast<const void*>(&target) == static_cast<const void*>(this))
+                return mapping;
+
+            // index[id] : position dans mapping, sert au dédoublonnage puis aux parents
+            std::vector<std::size_t> index(_manager.allocated(), NONE);
+            mapping.reserve(entities.size());
+            for (Entity e : entities)
+            {
+                if (!valid(e) || index[e.id()] != NONE)
+                    continue;
+                index[e.id()] = mapping.size();
+                mapping.push_back({e, INVALID_ENTITY});
+            }
+
+            std::vector<Entity> created;
+            target._manager.createMany(mapping.size(), created);
+            for (std::size_t i = created.size(); i < mapping.size(); i++)
+                index[mapping[i].first.id()] = NONE;
+            mapping.resize(created.size());
+            if (mapping.empty())
+                return mapping;
+            for (std::size_t i = 0; i < mapping.size(); i++)
+                mapping[i].second = created[i];
+            if (target._masks.size() < target._manager.allocated())
+                target._masks.resize(target._manager.allocated());
+
+            StaticForEach<ComponentList>([&](auto tag) {
+                using T = typename decltype(tag)::type;
+                auto& from = pool<T>();
+                std::vector<Entity> moved;
+                std::vector<Entity> sources;
+                std::vector<Entity> dormant;
+                for (const auto& [old, fresh] : mapping)
+                {
+                    if (!has<T>(old))
+                        continue;
+                    T& value = from.get(old);
+                    for (auto* obs : observers<T>())
+                        obs->onRemove(old, value);
+                    if (!from.isEnabled(old))
+                        dormant.push_back(fresh);
+                    moved.push_back(fresh);
+                    sources.push_back(old);
+                    forEachInterned(value, [&](InternedString& text) {
+                        InternedString copy = target._strings.intern(_strings.view(text));
+                        _strings.release(text);
+                        text = copy;
+                    });
+                }
+                if (moved.empty())
+                    return;
+                touch<T>();
+                auto& to = target.template pool<T>();
+                to.appendMoved(moved.data(), moved.size(), [&](std::size_t i) -> T& { return from.get(sources[i]); });
+                for (Entity old : sources)
+                {
+                    from.remove(old);
+                    _masks[old.id()].reset(componentId<T>());
+                }
+                for (Entity e : dormant)
+                    to.setEnabled(e, false);
+                for (Entity e : moved)
+                    target._masks[e.id()].set(target.template componentId<T>());
+                target.template touch<T>();
+                for (Entity e : moved)
+                    target.template notifyAdd<T>(e, to.get(e));
+            });
+
+            for (const auto& [old, fresh] : mapping)
+            {
+                if (isEnabled(old))
+                    continue;
+                if (fresh.id() >= target._disabled.size())
+                    target._disabled.resize(fresh.id() + 1, 0);
+                target._disabled[fresh.id()] = 1;
+            }
+
+            // attach() insère en premier enfant : parcourir l'ordre préfixe à l'envers garde
+            // l'ordre des frères
+            std::vector<std::pair<Entity, Entity>> links;
+            _hierarchy.forEachDepthFirst([&](Entity e, Entity parent) {
+                if (parent == INVALID_ENTITY || e.id() >= index.size() || parent.id() >= index.size())
+                    return;
+                std::size_t child = index[e.id()];
+                std::size_t owner = index[parent.id()];
+                if (child != NONE && owner != NONE)
+                    links.push_back({mapping[child].second, mapping[owner].second});
+            });
+            for (std::size_t i = links.size(); i-- > 0;)
+                target.setParent(links[i].first, links[i].second);
+
+            for (const auto& pair : mapping)
+                destroy(pair.first);
+            return mapping;
+        }
+
+        // Vide tous les storages en O(nombre de storages) en conservant leur capacité
+        void clear(void)
+        {
+            StaticForEach<ComponentTypes>([&](auto tag) {
+                using T = typename decltype(tag)::type;
+                pool<T>().clear();
+                touch<T>();
+                for (auto* obs : observers<T>())
+                    obs->onClear();
+            });
+            _manager.clear();
+            _masks.clear();
+            _disabled.clear();
+            _hierarchy.clear();
+            _strings.clear();
+        }
+
+        // Entités actives uniquement : seul le préfixe actif du premier storage est parcouru
         template <typename ComponentList, typename Func>
         void forEachEntityWith(Func&& fnc)
         {
             using First = typename Front<ComponentList>::type;
-            for (Entity e : storage<First>().entities())
+            const auto& driver = pool<First>();
+            std::vector<Entity> entities;
+            entities.reserve(driver.enabledSize());
+            for (std::size_t i = 0; i < driver.enabledSize(); i++)
+                entities.push_back(driver.entityAt(i));
+            for (Entity e : entities)
+            {
+                if (hasAll<ComponentList>(e))
+                    applyWith<ComponentList>(e, std::forward<Func>(fnc));
+            }
+        }
+
+        template <typename ComponentList, typename Func>
+        void forEachEntityWithIncludingDisabled(Func&& fnc)
+        {
+            using First = typename Front<ComponentList>::type;
+            for (Entity e : pool<First>().entities())
             {
                 if (hasAll<ComponentList>(e))
                     applyWith<ComponentList>(e, std::forward<Func>(fnc));
             }
         }
 
+        // Variante pilotée : ne visite que les entités actives de la plage (ex. résultat d'un index)
+        template <typename ComponentList, typename Func>
+        void forEachEntityWith(EntityRange driving, Func&& fnc)
+        {
+            for (Entity e : driving)
+            {
+                if (isEnabled(e) && hasAll<ComponentList>(e))
+                    applyWith<ComponentList>(e, fnc);
+            }
+        }
+
+        // Reprend au curseur, s'arrête à l'échéance ; renvoie true quand la passe est complète
+        template <typename ComponentList, typename Func>
+        bool forEachEntityWithSliced(SliceCursor& cursor, Func&& fnc)
+        {
+            using First = typename Front<ComponentList>::type;
+            auto& driver = pool<First>();
+            for (std::size_t n = 1; cursor.next < driver.enabledSize(); n++)
+            {
+                Entity e = driver.entityAt(cursor.next++);
+                if (hasAll<ComponentList>(e))
+                    applyWith<ComponentList>(e, fnc);
+                if (n % cursor.checkEvery == 0 && cursor.next < driver.enabledSize() && cursor.expired())
+                    return false;
+            }
+            cursor.next = 0;
+            return true;
+        }
+
+        // Requête type-erased : required construit à l'exécution via componentId<T>()
+        // Pilotée par le plus petit storage requis, parcouru à rebours pour tolérer les retraits
+        template <typename Func>
+        void forEachEntityMatching(const Mask& required, Func&& fnc)
+        {
+            using SizeFn = std::size_t (*)(const Registry&);
+            using EntityAtFn = Entity (*)(const Registry&, std::size_t);
+            static constexpr SizeFn sizes[] = {&Registry::storageEnabledSize<Cs>...};
+            static constexpr EntityAtFn entityAts[] = {&Registry::storageEntityAt<Cs>...};
+
+            if (required.none())
+            {
+                for (Entity e : _manager.getAliveEntities())
+                {
+                    if (isEnabled(e))
+                        fnc(e);
+                }
+                return;
+            }
+            std::size_t driver = sizeof...(Cs);
+            for (std::size_t id = 0; id < sizeof...(Cs); id++)
+            {
+                if (required.test(id) && (driver == sizeof...(Cs) || sizes[id](*this) < sizes[driver](*this)))
+                    driver = id;
+            }
+            for (std::size_t i = sizes[driver](*this); i-- > 0;)
+            {
+                if (i >= sizes[driver](*this))
+                    continue;
+                Entity e = entityAts[driver](*this, i);
+                if (hasAll(e, required))
+                    fnc(e);
+            }
+        }
+
         void debugEntity(Entity e) const
         {
-            std::cout << "[Entity] ID = " << e.id << ", version = " << e.version << " : ";
+            std::cout << "[Entity] ID = " << e.id() << ", version = " << e.version() << " : ";
+            Mask m = mask(e);
             StaticForEach<ComponentTypes>([&](auto tag) {
                 using T = typename decltype(tag)::type;
-                if (this->template has<T>(e))
+                if (m.test(componentId<T>()))
                     std::cout << " - Has :  " << typeid(T).name() << " ";
             });
         }
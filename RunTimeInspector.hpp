@@ -5,9 +5,123 @@
 #include <typeindex>
 #include <typeinfo>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <sstream>
 #include <tuple>
+#include <charconv>
+#include <cstring>
+#include <type_traits>
+#include <unistd.h>
+
+// Nom de type résolu à la compilation depuis la signature de la fonction
+template <typename T>
+constexpr std::string_view typeName(void)
+{
+#if defined(__clang__) || defined(__GNUC__)
+    std::string_view sig = __PRETTY_FUNCTION__;
+    std::size_t start = sig.find("T = ") + 4;
+    std::size_t end = sig.find_first_of(";]", start);
+    return sig.substr(start, end - start);
+#else
+    return typeid(T).name();
+#endif
+}
+
+// === ExportWriter : tampon fixe vidé vers un descripteur de fichier ===
+
+class ExportWriter
+{
+    private:
+
+        int _fd;
+        std::size_t _used = 0;
+        std::size_t _written = 0;
+        bool _failed = false;
+        char _buffer[1 << 16];
+
+    public:
+
+        explicit ExportWriter(int fd) : _fd(fd) {}
+        virtual ~ExportWriter(void) { flush(); }
+
+        ExportWriter(const ExportWriter&) = delete;
+        ExportWriter& operator=(const ExportWriter&) = delete;
+
+        void flush(void)
+        {
+            std::size_t offset = 0;
+            while (offset < _used && !_failed)
+            {
+                ssize_t n = ::write(_fd, _buffer + offset, _used - offset);
+                if (n <= 0)
+                    _failed = true;
+                else
+                    offset += static_cast<std::size_t>(n);
+            }
+            _written += offset;
+            _used = 0;
+        }
+
+        // Réserve n octets contigus dans le tampon
+        char* reserve(std::size_t n)
+        {
+            if (_used + n > sizeof(_buffer))
+                flush();
+            return _buffer + _used;
+        }
+
+        void commit(std::size_t n)
+        {
+            _used += n;
+        }
+
+        void put(char c)
+        {
+            *reserve(1) = c;
+            commit(1);
+        }
+
+        void put(std::string_view text)
+        {
+            while (!text.empty())
+            {
+                std::size_t chunk = std::min(text.size(), sizeof(_buffer) - _used);
+                if (chunk == 0)
+                {
+                    flush();
+                    continue;
+                }
+                std::memcpy(_buffer + _used, text.data(), chunk);
+                _used += chunk;
+                text.remove_prefix(chunk);
+            }
+        }
+
+        template <typename T>
+        void number(T value)
+        {
+            char* out = reserve(64);
+            auto res = std::to_chars(out, out + 64, value);
+            commit(static_cast<std::size_t>(res.ptr - out));
+        }
+
+        bool failed(void) const
+        {
+            return _failed;
+        }
+
+        std::size_t written(void) const
+        {
+            return _written + _used;
+        }
+};
+
+enum class ExportFormat
+{
+    Csv,
+    JsonLines
+};
 
 struct FieldInfo
 {
@@ -44,25 +158,147 @@ class RunTimeInspector
             constexpr auto size = std::tuple_size<Tuple>::value;
             applyImpl(tuple, std::forward<Func>(fnc), std::make_index_sequence<size>{});
         }
+
+        static void writeText(ExportWriter& out, std::string_view text, ExportFormat format)
+        {
+            if (format == ExportFormat::Csv)
+            {
+                if (text.find_first_of(",\"\n\r") == std::string_view::npos)
+                {
+                    out.put(text);
+                    return;
+                }
+                out.put('"');
+                for (char c : text)
+                {
+                    if (c == '"')
+                        out.put('"');
+                    out.put(c);
+                }
+                out.put('"');
+                return;
+            }
+            out.put('"');
+            for (char c : text)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    out.put('\\');
+                    out.put(c);
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    static const char hex[] = "0123456789abcdef";
+                    out.put("\\u00");
+                    out.put(hex[(c >> 4) & 0xF]);
+                    out.put(hex[c & 0xF]);
+                }
+                else
+                    out.put(c);
+            }
+            out.put('"');
+        }
+
+        template <typename V>
+        static void writeValue(ExportWriter& out, const V& value, ExportFormat format, const StringPool& strings)
+        {
+            if constexpr (std::is_same_v<V, bool>)
+                out.put(format == ExportFormat::Csv ? (value ? "1" : "0") : (value ? "true" : "false"));
+            else if constexpr (std::is_arithmetic_v<V>)
+                out.number(value);
+            else if constexpr (std::is_same_v<V, Entity>)
+                out.number(value.id());
+            else if constexpr (std::is_same_v<V, InternedString>)
+                writeText(out, strings.view(value), format);
+            else if constexpr (std::is_convertible_v<const V&, std::string_view>)
+                writeText(out, std::string_view(value), format);
+            else
+                static_assert(std::is_arithmetic_v<V>, "RunTimeInspector export: unsupported field type");
+        }
+
+        // Une colonne = un champ de tous les composants du storage, dans l'ordre dense
+        template <typename T, typename StorageT, typename Column>
+        static void writeColumn(ExportWriter& out, const StorageT& pool, std::string_view field, ExportFormat format, Column&& column)
+        {
+            constexpr std::string_view type = typeName<T>();
+            if (format == ExportFormat::Csv)
+            {
+                out.put(type);
+                out.put('.');
+                out.put(field);
+                for (std::size_t i = 0; i < pool.size(); i++)
+                {
+                    out.put(',');
+                    column(i);
+                }
+                out.put('\n');
+                return;
+            }
+            out.put("{\"component\":\"");
+            out.put(type);
+            out.put("\",\"field\":\"");
+            out.put(field);
+            out.put("\",\"values\":[");
+            for (std::size_t i = 0; i < pool.size(); i++)
+            {
+                if (i)
+                    out.put(',');
+                column(i);
+            }
+            out.put("]}\n");
+        }
+
+        template <typename T, typename StorageT, std::size_t... Is>
+        static void exportFields(ExportWriter& out, const StorageT& pool, ExportFormat format, const StringPool& strings, std::index_sequence<Is...>)
+        {
+            const T& first = pool.valueAt(0);
+            auto names = first.fieldNames();
+            (writeColumn<T>(out, pool, names[Is], format, [&](std::size_t i) {
+                const T& comp = pool.valueAt(i);
+                writeValue(out, std::get<Is>(comp.tie(comp)), format, strings);
+            }), ...);
+        }
     
     public:
 
         static EntityInfo inspectEntity(const Registry<ComponentList>& reg, Entity e)
         {
             EntityInfo info {e, {}};
+            auto mask = reg.mask(e);
             StaticForEach<ComponentList>([&](auto tag) {
                 using T = typename decltype(tag)::type;
-                if (reg.template has<T>(e))
+                if (mask.test(Registry<ComponentList>::template componentId<T>()))
                 {
                     const T& comp = reg.template get<T>(e);
-                    info.components.push_back(inspectComponent<T>(comp));
+                    info.components.push_back(inspectComponent<T>(comp, &reg.strings()));
                 }
             });
             return info;
         }
 
+        // Export colonne par colonne, sans structure intermédiaire : une ligne "entity" puis une ligne
+        // par champ de tie() pour chaque storage non vide. Renvoie false si l'écriture a échoué.
+        static bool exportColumns(const Registry<ComponentList>& reg, int fd, ExportFormat format = ExportFormat::Csv)
+        {
+            ExportWriter out(fd);
+            StaticForEach<ComponentList>([&](auto tag) {
+                using T = typename decltype(tag)::type;
+                const auto& pool = reg.template storage<T>();
+                if (pool.size() == 0)
+                    return;
+                writeColumn<T>(out, pool, "entity", format, [&](std::size_t i) {
+                    out.number(pool.entityAt(i).id());
+                });
+                using Fields = decltype(std::declval<const T&>().tie(std::declval<const T&>()));
+                exportFields<T>(out, pool, format, reg.strings(), std::make_index_sequence<std::tuple_size<Fields>::value>{});
+            });
+            out.flush();
+            return !out.failed();
+        }
+
         template <typename T>
-        static ComponentInfo inspectComponent(const T& comp)
+        // strings : pool du registry d'origine, pour afficher le texte des InternedString
+        static ComponentInfo inspectComponent(const T& comp, const StringPool* strings = nullptr)
         {
             ComponentInfo ci;
             ci.typeName = typeid(T).name();
@@ -70,7 +306,15 @@ class RunTimeInspector
             auto names = comp.fieldNames();
             applyToTuple(values, [&](std::size_t i, const auto& field) {
                 std::ostringstream oss;
-                oss << field;
+                if constexpr (std::is_same_v<std::decay_t<decltype(field)>, InternedString>)
+                {
+                    if (strings)
+                        oss << strings->view(field);
+                    else
+                        oss << '#' << field.index();
+                }
+                else
+                    oss << field;
                 ci.fields.push_back({names[i], oss.str()});
             });
             return ci;
@@ -0,0 +1,255 @@
+#pragma once
+
+#include "Registry.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// === StorageView : copie immuable d'un ComponentStorage ===
+
+template <typename T>
+class StorageView
+{
+    private:
+
+        static constexpr std::uint32_t INVALID = ~0u;
+        std::vector<std::uint32_t> _sparse;
+        std::vector<Entity> _entities;
+        std::vector<T> _data;
+        std::size_t _enabled = 0;
+
+    public:
+
+        template <typename StorageT>
+        void copyFrom(const StorageT& source)
+        {
+            std::fill(_sparse.begin(), _sparse.end(), INVALID);
+            _entities.clear();
+            _data.clear();
+            _entities.reserve(source.size());
+            _data.reserve(source.size());
+            for (std::size_t i = 0; i < source.size(); i++)
+            {
+                Entity e = source.entityAt(i);
+                if (e.id() >= _sparse.size())
+                    _sparse.resize(e.id() + 1, INVALID);
+                _sparse[e.id()] = static_cast<std::uint32_t>(i);
+                _entities.push_back(e);
+                if constexpr (!std::is_empty_v<T>)
+                    _data.push_back(source.get(e));
+            }
+            _enabled = source.enabledSize();
+        }
+
+        bool has(Entity e) const
+        {
+            return e.id() < _sparse.size() && _sparse[e.id()] != INVALID && _entities[_sparse[e.id()]] == e;
+        }
+
+        const T& get(Entity e) const
+        {
+            if constexpr (std::is_empty_v<T>)
+            {
+                static const T tag {};
+                return tag;
+            }
+            else
+                return _data[_sparse[e.id()]];
+        }
+
+        std::size_t size(void) const
+        {
+            return _entities.size();
+        }
+
+        // Entités actives en tête, comme dans le storage copié
+        std::size_t enabledSize(void) const
+        {
+            return _enabled;
+        }
+
+        Entity entityAt(std::size_t index) const
+        {
+            return _entities[index];
+        }
+};
+
+// === RegistrySnapshot : vue en lecture seule d'une frame publiée ===
+
+template <typename ComponentList>
+class RegistrySnapshot;
+
+template <typename... Cs>
+class RegistrySnapshot<TypeList<Cs...>>
+{
+    private:
+
+        template <typename ComponentList>
+        friend class SnapshotPublisher;
+
+        std::uint64_t _frame = 0;
+        IndexedTuple<std::shared_ptr<const StorageView<Cs>>...> _views;
+
+        template <typename ComponentList, typename Func>
+        struct ApplyWithImpl;
+
+        template <typename... Ts, typename Func>
+        struct ApplyWithImpl<TypeList<Ts...>, Func>
+        {
+            static void apply(const RegistrySnapshot& snap, Entity e, Func& fnc)
+            {
+                std::apply([&](const auto&... comps) { fnc(e, comps...); }, std::tuple_cat(snap.template componentArg<Ts>(e)...));
+            }
+        };
+
+        template <typename T>
+        auto componentArg(Entity e) const
+        {
+            if constexpr (std::is_empty_v<T>)
+                return std::tuple<>{};
+            else
+                return std::tuple<const T&>(get<T>(e));
+        }
+
+        template <typename... Ts>
+        bool hasAllImpl(Entity e, TypeList<Ts...>) const
+        {
+            return (has<Ts>(e) && ...);
+        }
+
+    public:
+
+        template <typename T>
+        const StorageView<T>& view(void) const
+        {
+            return *slotAt<IndexOf<T, TypeList<Cs...>>::value>(_views);
+        }
+
+        std::uint64_t frame(void) const
+        {
+            return _frame;
+        }
+
+        template <typename T>
+        bool has(Entity e) const
+        {
+            return view<T>().has(e);
+        }
+
+        template <typename T>
+        const T& get(Entity e) const
+        {
+            return view<T>().get(e);
+        }
+
+        template <typename T>
+        const T* getIf(Entity e) const
+        {
+            return has<T>(e) ? &get<T>(e) : nullptr;
+        }
+
+        template <typename ComponentList>
+        bool hasAll(Entity e) const
+        {
+            return hasAllImpl(e, ComponentList{});
+        }
+
+        template <typename ComponentList, typename Func>
+        void forEachEntityWith(Func&& fnc) const
+        {
+            using First = typename Front<ComponentList>::type;
+            const StorageView<First>& driver = view<First>();
+            for (std::size_t i = 0; i < driver.enabledSize(); i++)
+            {
+                Entity e = driver.entityAt(i);
+                if (hasAll<ComponentList>(e))
+                    ApplyWithImpl<ComponentList, Func>::apply(*this, e, fnc);
+            }
+        }
+};
+
+// === SnapshotPublisher : publication en fin de frame, lecture sans arrêt du monde ===
+// Seuls les storages modifiés depuis la publication précédente sont recopiés, les autres
+// sont partagés avec le snapshot précédent. Le tampon remplacé est réutilisé dès qu'aucun
+// lecteur ne le retient plus (double tampon par storage).
+
+template <typename ComponentList>
+class SnapshotPublisher;
+
+template <typename... Cs>
+class SnapshotPublisher<TypeList<Cs...>>
+{
+    private:
+
+        using Snapshot = RegistrySnapshot<TypeList<Cs...>>;
+
+        std::shared_ptr<const Snapshot> _current;
+        IndexedTuple<std::shared_ptr<const StorageView<Cs>>...> _spares;
+        std::uint64_t _frame = 0;
+        std::uint64_t _copied = 0;
+
+    public:
+
+        using Type = TypeList<Cs...>;
+
+        SnapshotPublisher(void) = default;
+        virtual ~SnapshotPublisher(void) = default;
+
+        // Thread de simulation uniquement, entre deux frames
+        void publish(Registry<TypeList<Cs...>>& reg)
+        {
+            auto next = std::make_shared<Snapshot>();
+            next->_frame = ++_frame;
+            std::shared_ptr<const Snapshot> previous = std::atomic_load(&_current);
+            const auto& dirty = reg.dirtyStorages();
+            StaticForEach<TypeList<Cs...>>([&](auto tag) {
+                using T = typename decltype(tag)::type;
+                using ViewPtr = std::shared_ptr<const StorageView<T>>;
+                constexpr std::size_t I = IndexOf<T, TypeList<Cs...>>::value;
+                ViewPtr& slot = slotAt<I>(next->_views);
+                if (previous && !dirty.test(Registry<TypeList<Cs...>>::template componentId<T>()))
+                {
+                    slot = slotAt<I>(previous->_views);
+                    return;
+                }
+                ViewPtr& spare = slotAt<I>(_spares);
+                std::shared_ptr<StorageView<T>> fresh;
+                if (spare && spare.use_count() == 1)
+                {
+                    // use_count() est une lecture relâchée : la barrière ordonne la réécriture
+                    // après le relâchement du dernier lecteur, qui a pu avoir lieu sur un autre thread
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    fresh = std::const_pointer_cast<StorageView<T>>(spare);
+                }
+                else
+                    fresh = std::make_shared<StorageView<T>>();
+                spare = previous ? slotAt<I>(previous->_views) : nullptr;
+                fresh->copyFrom(std::as_const(reg).template storage<T>());
+                slot = std::move(fresh);
+                _copied++;
+            });
+            reg.clearDirtyStorages();
+            std::atomic_store(&_current, std::shared_ptr<const Snapshot>(std::move(next)));
+        }
+
+        // N'importe quel thread : le snapshot reste valide tant qu'on le détient. L'échange du
+        // pointeur passe par std::atomic_load / atomic_store, verrouillés en interne par libstdc++
+        std::shared_ptr<const Snapshot> acquire(void) const
+        {
+            return std::atomic_load(&_current);
+        }
+
+        std::uint64_t published(void) const
+        {
+            return _frame;
+        }
+
+        std::uint64_t storagesCopied(void) const
+        {
+            return _copied;
+        }
+};
\ No newline at end of file
@@ -0,0 +1,289 @@
+#pragma once
+
+#include "Registry.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// === SpatialTraits : accès aux coordonnées d'un composant position ===
+
+template <typename T>
+struct SpatialTraits
+{
+    static float x(const T& p) { return p.x; }
+    static float y(const T& p) { return p.y; }
+};
+
+// === SpatialGrid : grille uniforme bornée, maintenue via ComponentObserver ===
+// Les entités hors des bornes sont rangées dans les cellules du bord.
+// Seules les entités ajoutées ou accédées en écriture sont re-rangées, au début de la requête suivante.
+
+template <typename ComponentList, typename T>
+class SpatialGrid : public ComponentObserver<T>
+{
+    private:
+
+        static constexpr std::uint32_t NONE = ~0u;
+
+        struct Cell
+        {
+            Entity e;
+            float x;
+            float y;
+        };
+
+        struct Slot
+        {
+            std::uint32_t cell = NONE;
+            std::uint32_t index = 0;
+        };
+
+        Registry<ComponentList>& _registry;
+        float _minX;
+        float _minY;
+        float _cellSize;
+        std::uint32_t _cols;
+        std::uint32_t _rows;
+        std::vector<std::vector<Cell>> _cells;
+        std::vector<Slot> _slots;
+        std::vector<Entity> _dirty;
+        std::vector<std::uint8_t> _dirtyFlags;
+        std::vector<Entity> _results;
+        std::vector<std::pair<float, Entity>> _nearest;
+
+        std::uint32_t column(float x) const
+        {
+            float c = std::floor((x - _minX) / _cellSize);
+            return static_cast<std::uint32_t>(std::clamp(c, 0.0f, static_cast<float>(_cols - 1)));
+        }
+
+        std::uint32_t row(float y) const
+        {
+            float r = std::floor((y - _minY) / _cellSize);
+            return static_cast<std::uint32_t>(std::clamp(r, 0.0f, static_cast<float>(_rows - 1)));
+        }
+
+        std::uint32_t cellOf(float x, float y) const
+        {
+            return row(y) * _cols + column(x);
+        }
+
+        Slot& slot(Entity e)
+        {
+            if (e.id() >= _slots.size())
+            {
+                _slots.resize(e.id() + 1);
+                _dirtyFlags.resize(e.id() + 1, 0);
+            }
+            return _slots[e.id()];
+        }
+
+        void insert(Entity e, float x, float y)
+        {
+            Slot& s = slot(e);
+            s.cell = cellOf(x, y);
+            s.index = static_cast<std::uint32_t>(_cells[s.cell].size());
+            _cells[s.cell].push_back({e, x, y});
+        }
+
+        void erase(Slot& s)
+        {
+            auto& cell = _cells[s.cell];
+            if (s.index != cell.size() - 1)
+            {
+                cell[s.index] = cell.back();
+                _slots[cell[s.index].e.id()].index = s.index;
+            }
+            cell.pop_back();
+            s.cell = NONE;
+        }
+
+        template <typename Func>
+        void forEachInBox(float minX, float minY, float maxX, float maxY, Func&& fnc) const
+        {
+            for (std::uint32_t r = row(minY); r <= row(maxY); r++)
+            {
+                for (std::uint32_t c = column(minX); c <= column(maxX); c++)
+                {
+                    for (const Cell& entry : _cells[r * _cols + c])
+                        fnc(entry);
+                }
+            }
+        }
+
+        static bool closer(const std::pair<float, Entity>& a, const std::pair<float, Entity>& b)
+        {
+            return a.first < b.first;
+        }
+
+        EntityRange results(void) const
+        {
+            return {_results.data(), _results.data() + _results.size()};
+        }
+
+    public:
+
+        SpatialGrid(Registry<ComponentList>& reg, float minX, float minY, float maxX, float maxY, float cellSize)
+            : _registry(reg), _minX(minX), _minY(minY), _cellSize(cellSize)
+        {
+            _cols = std::max<std::uint32_t>(1, static_cast<std::uint32_t>(std::ceil((maxX - minX) / cellSize)));
+            _rows = std::max<std::uint32_t>(1, static_cast<std::uint32_t>(std::ceil((maxY - minY) / cellSize)));
+            _cells.resize(static_cast<std::size_t>(_cols) * _rows);
+            const auto& pool = std::as_const(_registry).template storage<T>();
+            for (std::size_t i = 0; i < pool.size(); i++)
+            {
+                Entity e = pool.entityAt(i);
+                const T& p = pool.get(e);
+                insert(e, SpatialTraits<T>::x(p), SpatialTraits<T>::y(p));
+            }
+            _registry.template connect<T>(this);
+        }
+
+        virtual ~SpatialGrid(void)
+        {
+            _registry.template disconnect<T>(this);
+        }
+
+        SpatialGrid(const SpatialGrid&) = delete;
+        SpatialGrid& operator=(const SpatialGrid&) = delete;
+
+        void onAdd(Entity e, const T& p) override
+        {
+            Slot& s = slot(e);
+            if (s.cell != NONE)
+                erase(s);
+            insert(e, SpatialTraits<T>::x(p), SpatialTraits<T>::y(p));
+        }
+
+        void onRemove(Entity e, const T&) override
+        {
+            Slot& s = slot(e);
+            if (s.cell != NONE)
+                erase(s);
+        }
+
+        void onClear(void) override
+        {
+            for (auto& cell : _cells)
+                cell.clear();
+            _slots.clear();
+            _dirty.clear();
+            _dirtyFlags.clear();
+        }
+
+        void onPatch(Entity e) override
+        {
+            slot(e);
+            if (!_dirtyFlags[e.id()])
+            {
+                _dirtyFlags[e.id()] = 1;
+                _dirty.push_back(e);
+            }
+        }
+
+        // Re-range les entités modifiées depuis le dernier appel
+        void refresh(void)
+        {
+            const auto& pool = std::as_const(_registry).template storage<T>();
+            for (Entity e : _dirty)
+            {
+                _dirtyFlags[e.id()] = 0;
+                Slot& s = _slots[e.id()];
+                if (s.cell == NONE || !pool.has(e))
+                    continue;
+                const T& p = pool.get(e);
+                float x = SpatialTraits<T>::x(p);
+                float y = SpatialTraits<T>::y(p);
+                std::uint32_t target = cellOf(x, y);
+                if (target == s.cell)
+                {
+                    Cell& entry = _cells[s.cell][s.index];
+                    entry.x = x;
+                    entry.y = y;
+                    continue;
+                }
+                erase(s);
+                insert(e, x, y);
+            }
+            _dirty.clear();
+        }
+
+        // Les plages renvoyées restent valides jusqu'à la requête suivante
+        EntityRange queryAABB(float minX, float minY, float maxX, float maxY)
+        {
+            refresh();
+            _results.clear();
+            forEachInBox(minX, minY, maxX, maxY, [&](const Cell& entry) {
+                if (entry.x >= minX && entry.x <= maxX && entry.y >= minY && entry.y <= maxY)
+                    _results.push_back(entry.e);
+            });
+            return results();
+        }
+
+        EntityRange queryRadius(float x, float y, float radius)
+        {
+            refresh();
+            _results.clear();
+            float r2 = radius * radius;
+            forEachInBox(x - radius, y - radius, x + radius, y + radius, [&](const Cell& entry) {
+                float dx = entry.x - x;
+                float dy = entry.y - y;
+                if (dx * dx + dy * dy <= r2)
+                    _results.push_back(entry.e);
+            });
+            return results();
+        }
+
+        // Les k plus proches, triés par distance ; recherche par anneaux de cellules
+        EntityRange queryNearest(float x, float y, std::size_t k)
+        {
+            refresh();
+            _results.clear();
+            _nearest.clear();
+            if (k == 0)
+                return results();
+            std::int64_t cx = column(x);
+            std::int64_t cy = row(y);
+            std::int64_t maxRing = std::max(_cols, _rows);
+            for (std::int64_t ring = 0; ring <= maxRing; ring++)
+            {
+                for (std::int64_t r = cy - ring; r <= cy + ring; r++)
+                {
+                    if (r < 0 || r >= static_cast<std::int64_t>(_rows))
+                        continue;
+                    bool edgeRow = (r == cy - ring || r == cy + ring);
+                    for (std::int64_t c = cx - ring; c <= cx + ring; c += (edgeRow || ring == 0) ? 1 : 2 * ring)
+                    {
+                        if (c < 0 || c >= static_cast<std::int64_t>(_cols))
+                            continue;
+                        for (const Cell& entry : _cells[r * _cols + c])
+                        {
+                            float dx = entry.x - x;
+                            float dy = entry.y - y;
+                            _nearest.emplace_back(dx * dx + dy * dy, entry.e);
+                        }
+                    }
+                }
+                if (_nearest.size() > k)
+                {
+                    std::nth_element(_nearest.begin(), _nearest.begin() + (k - 1), _nearest.end(), closer);
+                    _nearest.resize(k);
+                }
+                // Toute cellule hors de l'anneau est à au moins ring * cellSize du point
+                float reach = static_cast<float>(ring) * _cellSize;
+                if (_nearest.size() == k && std::max_element(_nearest.begin(), _nearest.end(), closer)->first <= reach * reach)
+                    break;
+            }
+            std::sort(_nearest.begin(), _nearest.end(), closer);
+            for (const auto& n : _nearest)
+                _results.push_back(n.second);
+            return results();
+        }
+
+        std::size_t pending(void) const
+        {
+            return _dirty.size();
+        }
+};
\ No newline at end of file
@@ -0,0 +1,302 @@
+#pragma once
+
+#include "Storage.hpp"
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+// === StableComponentStorage : adresses stables pendant toute la vie du composant ===
+// Les valeurs vivent dans des pages de taille fixe jamais déplacées. Un retrait détruit la
+// valeur sur place et laisse une case libre (tombstone) réutilisée par l'ajout suivant ;
+// seule la liste dense d'entités, qui pilote l'itération, est compactée par échange.
+// compact() range les valeurs dans l'ordre dense et libère les pages vides : c'est le seul
+// appel qui invalide les pointeurs.
+
+template <typename T, std::size_t PageSize = 1024>
+class StableComponentStorage
+{
+    private:
+
+        static constexpr std::size_t INVALID = static_cast<std::size_t>(-1);
+
+        struct Page
+        {
+            alignas(T) unsigned char bytes[sizeof(T) * PageSize];
+        };
+
+        std::vector<std::unique_ptr<Page>> pages;
+        std::vector<std::size_t> sparse;
+        std::vector<Entity> denseEntities;
+        std::vector<std::size_t> denseSlots;
+        std::vector<std::size_t> owner;
+        std::vector<std::size_t> free;
+        std::size_t enabled = 0;
+
+        T* at(std::size_t slot)
+        {
+            return std::launder(reinterpret_cast<T*>(pages[slot / PageSize]->bytes) + slot % PageSize);
+        }
+
+        const T* at(std::size_t slot) const
+        {
+            return std::launder(reinterpret_cast<const T*>(pages[slot / PageSize]->bytes) + slot % PageSize);
+        }
+
+        void ensure(const std::size_t& id)
+        {
+            if (id >= sparse.size())
+                sparse.resize(id + 1, INVALID);
+        }
+
+        // Case libre la plus récente, sinon une nouvelle case en fin de dernière page
+        std::size_t acquireSlot(void)
+        {
+            if (!free.empty())
+            {
+                std::size_t slot = free.back();
+                free.pop_back();
+                return slot;
+            }
+            std::size_t slot = owner.size();
+            if (slot / PageSize >= pages.size())
+                pages.push_back(std::unique_ptr<Page>(new Page));
+            owner.push_back(INVALID);
+            return slot;
+        }
+
+        template <typename V>
+        T& insert(Entity e, V&& value)
+        {
+            std::size_t slot = acquireSlot();
+            T* ptr = new (at(slot)) T(std::forward<V>(value));
+            owner[slot] = denseEntities.size();
+            sparse[e.id()] = slot;
+            denseEntities.push_back(e);
+            denseSlots.push_back(slot);
+            swapSlots(denseEntities.size() - 1, enabled++);
+            return *ptr;
+        }
+
+        void swapSlots(std::size_t a, std::size_t b)
+        {
+            if (a == b)
+                return;
+            std::swap(denseEntities[a], denseEntities[b]);
+            std::swap(denseSlots[a], denseSlots[b]);
+            owner[denseSlots[a]] = a;
+            owner[denseSlots[b]] = b;
+        }
+
+        void fill(std::size_t index, std::size_t from)
+        {
+            if (index == from)
+                return;
+            denseEntities[index] = denseEntities[from];
+            denseSlots[index] = denseSlots[from];
+            owner[denseSlots[index]] = index;
+        }
+
+        void destroyAll(void)
+        {
+            for (std::size_t slot : denseSlots)
+                at(slot)->~T();
+        }
+
+    public:
+
+        StableComponentStorage(void) = default;
+
+        virtual ~StableComponentStorage(void)
+        {
+            destroyAll();
+        }
+
+        StableComponentStorage(const StableComponentStorage&) = delete;
+        StableComponentStorage& operator=(const StableComponentStorage&) = delete;
+
+        bool has(Entity e) const
+        {
+            return e.id() < sparse.size() && sparse[e.id()] != INVALID && denseEntities[owner[sparse[e.id()]]].id() == e.id();
+        }
+
+        T& emplace(Entity e, const T& value)
+        {
+            ensure(e.id());
+            if (!has(e))
+                return insert(e, value);
+            T& comp = get(e);
+            comp = value;
+            return comp;
+        }
+
+        T& emplace(Entity e, T&& value)
+        {
+            ensure(e.id());
+            if (!has(e))
+                return insert(e, std::move(value));
+            T& comp = get(e);
+            comp = std::move(value);
+            return comp;
+        }
+
+        // O(1), aucune valeur déplacée : seule l'entrée dense de la dernière entité change de place
+        void remove(Entity e)
+        {
+            if (!has(e))
+                return;
+            std::size_t slot = sparse[e.id()];
+            std::size_t index = owner[slot];
+            at(slot)->~T();
+            owner[slot] = INVALID;
+            free.push_back(slot);
+            if (index < enabled)
+            {
+                fill(index, --enabled);
+                index = enabled;
+            }
+            fill(index, denseEntities.size() - 1);
+            denseEntities.pop_back();
+            denseSlots.pop_back();
+            sparse[e.id()] = INVALID;
+        }
+
+        T& get(Entity e)
+        {
+            return *at(sparse[e.id()]);
+        }
+
+        const T& get(Entity e) const
+        {
+            return *at(sparse[e.id()]);
+        }
+
+        std::vector<Entity> entities(void) const
+        {
+            return denseEntities;
+        }
+
+        std::size_t size(void) const
+        {
+            return denseEntities.size();
+        }
+
+        std::size_t enabledSize(void) const
+        {
+            return enabled;
+        }
+
+        bool isEnabled(Entity e) const
+        {
+            return has(e) && owner[sparse[e.id()]] < enabled;
+        }
+
+        // Seul l'ordre dense change : les valeurs, et donc leurs adresses, ne bougent pas
+        void setEnabled(Entity e, bool on)
+        {
+            if (!has(e) || isEnabled(e) == on)
+                return;
+            if (on)
+                swapSlots(owner[sparse[e.id()]], enabled++);
+            else
+                swapSlots(owner[sparse[e.id()]], --enabled);
+        }
+
+        Entity entityAt(std::size_t index) const
+        {
+            return denseEntities[index];
+        }
+
+        const T& valueAt(std::size_t index) const
+        {
+            return *at(denseSlots[index]);
+        }
+
+        T& valueAt(std::size_t index)
+        {
+            return *at(denseSlots[index]);
+        }
+
+        std::size_t tombstones(void) const
+        {
+            return free.size();
+        }
+
+        void clear(void)
+        {
+            destroyAll();
+            sparse.clear();
+            denseEntities.clear();
+            denseSlots.clear();
+            owner.clear();
+            free.clear();
+            enabled = 0;
+        }
+
+        std::size_t appendBulk(const Entity* entities, std::size_t count, const T& value)
+        {
+            std::size_t first = enabled;
+            if (count == 0)
+                return first;
+            std::uint32_t maxId = 0;
+            for (std::size_t i = 0; i < count; i++)
+                maxId = std::max(maxId, entities[i].id());
+            ensure(maxId);
+            denseEntities.reserve(denseEntities.size() + count);
+            denseSlots.reserve(denseSlots.size() + count);
+            for (std::size_t i = 0; i < count; i++)
+                insert(entities[i], value);
+            return first;
+        }
+
+        // Chaque valeur est construite sur place dans sa case par déplacement depuis source(i)
+        template <typename Source>
+        std::size_t appendMoved(const Entity* entities, std::size_t count, Source&& source)
+        {
+            std::size_t first = enabled;
+            if (count == 0)
+                return first;
+            std::uint32_t maxId = 0;
+            for (std::size_t i = 0; i < count; i++)
+                maxId = std::max(maxId, entities[i].id());
+            ensure(maxId);
+            denseEntities.reserve(denseEntities.size() + count);
+            denseSlots.reserve(denseSlots.size() + count);
+            for (std::size_t i = 0; i < count; i++)
+                insert(entities[i], std::move(source(i)));
+            return first;
+        }
+
+        // Place la valeur d'indice dense i dans la case i : O(size()) échanges ou déplacements,
+        // puis libère les pages devenues inutiles. Invalide tous les pointeurs sur les valeurs.
+        void compact(void)
+        {
+            std::size_t count = denseEntities.size();
+            for (std::size_t i = 0; i < count; i++)
+            {
+                std::size_t slot = denseSlots[i];
+                if (slot == i)
+                    continue;
+                if (owner[i] != INVALID)
+                {
+                    std::size_t other = owner[i];
+                    std::swap(*at(i), *at(slot));
+                    denseSlots[other] = slot;
+                    owner[slot] = other;
+                    sparse[denseEntities[other].id()] = slot;
+                }
+                else
+                {
+                    new (at(i)) T(std::move(*at(slot)));
+                    at(slot)->~T();
+                    owner[slot] = INVALID;
+                }
+                denseSlots[i] = i;
+                owner[i] = i;
+                sparse[denseEntities[i].id()] = i;
+            }
+            owner.resize(count);
+            free.clear();
+            pages.resize((count + PageSize - 1) / PageSize);
+        }
+};
\ No newline at end of file
@@ -2,26 +2,101 @@
 
 #include <vector>
 #include <cstdint>
+#include <algorithm>
+#include <iterator>
 #include <unordered_map>
+#include <type_traits>
 
 // === Entity / Manager  ===
 
-struct Entity 
+// Découpage id / version d'un handle compact : Raw = entier porteur, IdBits = bits d'index
+template <typename Raw, unsigned IdBits>
+struct EntityLayout
 {
-    std::uint32_t id = 0;
-    std::uint32_t version = 1;
-    bool operator==(const Entity& other) const
+    static_assert(IdBits > 0 && IdBits < sizeof(Raw) * 8, "EntityLayout: IdBits must leave room for a version");
+    static_assert(IdBits <= 32 && sizeof(Raw) * 8 - IdBits <= 32, "EntityLayout: id and version must fit in 32 bits");
+
+    using RawType = Raw;
+    static constexpr unsigned ID_BITS = IdBits;
+    static constexpr unsigned VERSION_BITS = sizeof(Raw) * 8 - IdBits;
+    static constexpr Raw ID_MASK = static_cast<Raw>((Raw(1) << IdBits) - 1);
+    static constexpr Raw VERSION_MASK = static_cast<Raw>(~Raw(0) >> IdBits);
+};
+
+using EntityLayout32 = EntityLayout<std::uint32_t, 20>;
+using EntityLayout64 = EntityLayout<std::uint64_t, 32>;
+
+// -DECS_COMPACT_ENTITY : handles 32 bits (2^20 - 1 entités, 2^12 - 1 versions)
+#ifndef ECS_ENTITY_LAYOUT
+    #ifdef ECS_COMPACT_ENTITY
+        #define ECS_ENTITY_LAYOUT EntityLayout32
+    #else
+        #define ECS_ENTITY_LAYOUT EntityLayout64
+    #endif
+#endif
+
+template <typename Layout>
+struct BasicEntity
+{
+    using RawType = typename Layout::RawType;
+
+    RawType raw = pack(0, 1);
+
+    constexpr BasicEntity(void) = default;
+    constexpr BasicEntity(std::uint32_t id, std::uint32_t version) : raw(pack(id, version)) {}
+
+    static constexpr RawType pack(std::uint32_t id, std::uint32_t version)
     {
-        return (id == other.id && version == other.version);
+        return static_cast<RawType>((RawType(version) & Layout::VERSION_MASK) << Layout::ID_BITS) | (RawType(id) & Layout::ID_MASK);
     }
-    bool operator!=(const Entity& other) const
+
+    // La version maximale est réservée à INVALID_ENTITY : on reboucle sur 0
+    static constexpr std::uint32_t nextVersion(std::uint32_t version)
     {
-        return (id != other.id && version != other.version);
+        RawType next = (RawType(version) + 1) & Layout::VERSION_MASK;
+        return next == Layout::VERSION_MASK ? 0 : static_cast<std::uint32_t>(next);
+    }
+
+    constexpr std::uint32_t id(void) const
+    {
+        return static_cast<std::uint32_t>(raw & Layout::ID_MASK);
+    }
+
+    constexpr std::uint32_t version(void) const
+    {
+        return static_cast<std::uint32_t>(raw >> Layout::ID_BITS);
+    }
+
+    constexpr bool operator==(const BasicEntity& other) const
+    {
+        return raw == other.raw;
+    }
+
+    constexpr bool operator!=(const BasicEntity& other) const
+    {
+        return raw != other.raw;
     }
 };
 
+using Entity = BasicEntity<ECS_ENTITY_LAYOUT>;
+
+static_assert(sizeof(Entity) == sizeof(Entity::RawType), "Entity must stay a single packed integer");
+
+constexpr std::uint32_t MAX_ENTITY_ID = static_cast<std::uint32_t>(ECS_ENTITY_LAYOUT::ID_MASK);
 constexpr Entity INVALID_ENTITY {~0u, ~0u};
 
+// Vue non possédante sur un tableau contigu d'entités
+struct EntityRange
+{
+    const Entity* first = nullptr;
+    const Entity* last = nullptr;
+
+    const Entity* begin(void) const { return first; }
+    const Entity* end(void) const { return last; }
+    std::size_t size(void) const { return static_cast<std::size_t>(last - first); }
+    bool empty(void) const { return first == last; }
+};
+
 class EntityManager 
 {
     private:
@@ -38,28 +113,43 @@ class EntityManager
         {
             if (!free.empty()) 
             {
-                Entity e = free.back();
+                Entity old = free.back();
                 free.pop_back();
-                e.version++;
-                alive[e.id] = e;
+                Entity e {old.id(), Entity::nextVersion(old.version())};
+                alive[e.id()] = e;
                 return e;
             }
+            if (nextId >= MAX_ENTITY_ID)
+                return INVALID_ENTITY;
             Entity e {nextId++, 1};
-            alive[e.id] = e;
+            alive[e.id()] = e;
             return e;
         }
 
         void destroy(Entity e) 
         {
-            if (e.id >= nextId)
+            if (e.id() >= nextId)
                 return;
             free.push_back(e);
-            alive.erase(e.id);
+            alive.erase(e.id());
         }
 
-        void preAllocate(std::size_t count)
+        void createMany(std::size_t count, std::vector<Entity>& out)
         {
+            out.reserve(out.size() + count);
+            alive.reserve(alive.size() + count);
             for (std::size_t i = 0; i < count; i++)
+            {
+                Entity e = create();
+                if (e == INVALID_ENTITY)
+                    return;
+                out.push_back(e);
+            }
+        }
+
+        void preAllocate(std::size_t count)
+        {
+            for (std::size_t i = 0; i < count && nextId < MAX_ENTITY_ID; i++)
                 free.push_back(Entity{nextId++, 1});
         }
 
@@ -69,6 +159,51 @@ class EntityManager
             free.clear();
         }
 
+        // Oublie toutes les entités en gardant la capacité des conteneurs
+        void clear(void)
+        {
+            nextId = 0;
+            free.clear();
+            alive.clear();
+        }
+
+        // Réenregistre un handle existant (storage rechargé) sans changer sa version
+        void adopt(Entity e)
+        {
+            alive[e.id()] = e;
+            if (e.id() >= nextId)
+                nextId = e.id() + 1;
+        }
+
+        // Après des adopt() : les ids sous nextId ni vivants ni libres redeviennent libres
+        void rebuildFree(void)
+        {
+            std::vector<std::uint8_t> known(nextId, 0);
+            std::size_t kept = 0;
+            for (Entity e : free)
+            {
+                if (e.id() < nextId && !known[e.id()] && alive.find(e.id()) == alive.end())
+                {
+                    known[e.id()] = 1;
+                    free[kept++] = e;
+                }
+            }
+            free.resize(kept);
+            for (const auto& pair : alive)
+                known[pair.first] = 1;
+            for (std::uint32_t id = nextId; id-- > 0;)
+            {
+                if (!known[id])
+                    free.push_back(Entity{id, 0});
+            }
+        }
+
+        bool isAlive(Entity e) const
+        {
+            auto it = alive.find(e.id());
+            return it != alive.end() && it->second == e;
+        }
+
         std::size_t freeCount(void) const
         {
             return free.size();
@@ -90,7 +225,7 @@ class EntityManager
 
 // === SparseSet Storage ===
 
-template <typename T>
+template <typename T, bool Tag = std::is_empty_v<T>>
 class ComponentStorage 
 {
     private:
@@ -99,6 +234,7 @@ class ComponentStorage
         std::vector<std::size_t> sparse;
         std::vector<Entity> denseEntities;
         std::vector<T> denseData;
+        std::size_t enabled = 0;
 
         void ensure(const std::size_t& id) 
         {
@@ -106,27 +242,89 @@ class ComponentStorage
                 sparse.resize(id + 1, INVALID);
         }
 
+        void swapSlots(std::size_t a, std::size_t b)
+        {
+            if (a == b)
+                return;
+            std::swap(denseEntities[a], denseEntities[b]);
+            std::swap(denseData[a], denseData[b]);
+            sparse[denseEntities[a].id()] = a;
+            sparse[denseEntities[b].id()] = b;
+        }
+
+        // Comble le trou laissé en index par le dernier élément
+        void fill(std::size_t index, std::size_t from)
+        {
+            if (index == from)
+                return;
+            denseEntities[index] = denseEntities[from];
+            denseData[index] = std::move(denseData[from]);
+            sparse[denseEntities[index].id()] = index;
+        }
+
+        void ensureAll(const Entity* entities, std::size_t count)
+        {
+            std::uint32_t maxId = 0;
+            for (std::size_t i = 0; i < count; i++)
+                maxId = std::max(maxId, entities[i].id());
+            ensure(maxId);
+        }
+
+        // Le bloc [base, size()) tout juste ajouté passe devant les entités désactivées
+        std::size_t enableAppended(const Entity* entities, std::size_t base, std::size_t count)
+        {
+            for (std::size_t i = 0; i < count; i++)
+                sparse[entities[i].id()] = base + i;
+            std::size_t first = enabled;
+            if (first != base)
+            {
+                std::rotate(denseEntities.begin() + first, denseEntities.begin() + base, denseEntities.end());
+                std::rotate(denseData.begin() + first, denseData.begin() + base, denseData.end());
+                for (std::size_t i = first; i < denseEntities.size(); i++)
+                    sparse[denseEntities[i].id()] = i;
+            }
+            enabled += count;
+            return first;
+        }
+
     public:
 
         virtual ~ComponentStorage(void) = default;
 
         bool has(Entity e) const
         {
-            return e.id < sparse.size() && sparse[e.id] != INVALID && denseEntities[sparse[e.id]].id == e.id;
+            return e.id() < sparse.size() && sparse[e.id()] != INVALID && denseEntities[sparse[e.id()]].id() == e.id();
         }
 
         T& emplace(Entity e, const T& value)
         {
-            ensure(e.id);
+            ensure(e.id());
             if (!has(e))
             {
                 std::size_t i = denseData.size();
-                sparse[e.id] = i;
+                sparse[e.id()] = i;
                 denseEntities.push_back(e);
                 denseData.push_back(value);
-                return denseData.back();
+                swapSlots(i, enabled++);
+                return denseData[sparse[e.id()]];
+            }
+            denseData[sparse[e.id()]] = value;
+            return get(e);
+        }
+
+        T& emplace(Entity e, T&& value)
+        {
+            ensure(e.id());
+            if (!has(e))
+            {
+                std::size_t i = denseData.size();
+                sparse[e.id()] = i;
+                denseEntities.push_back(e);
+                denseData.push_back(std::move(value));
+                swapSlots(i, enabled++);
+                return denseData[sparse[e.id()]];
             }
-            denseData[sparse[e.id]] = value;
+            denseData[sparse[e.id()]] = std::move(value);
             return get(e);
         }
 
@@ -134,31 +332,294 @@ class ComponentStorage
         {
             if (!has(e))
                 return;
-            std::size_t index = sparse[e.id];
-            std::size_t last = denseData.size() - 1;
-            if (index != last) 
+            std::size_t index = sparse[e.id()];
+            if (index < enabled)
             {
-                denseEntities[index] = denseEntities[last];
-                denseData[index] = denseData[last];
-                sparse[denseEntities[index].id] = index;
+                fill(index, --enabled);
+                index = enabled;
             }
+            fill(index, denseData.size() - 1);
             denseEntities.pop_back();
             denseData.pop_back();
-            sparse[e.id] = INVALID;
+            sparse[e.id()] = INVALID;
         }
 
         T& get(Entity e) 
         {
-            return denseData[sparse[e.id]];
+            return denseData[sparse[e.id()]];
         }
 
         const T& get(Entity e) const
         {
-            return denseData[sparse[e.id]];
+            return denseData[sparse[e.id()]];
+        }
+
+        std::vector<Entity> entities(void) const
+        {
+            return denseEntities;
+        }
+
+        std::size_t size(void) const
+        {
+            return denseEntities.size();
+        }
+
+        // Entités actives : préfixe [0, enabledSize()) des tableaux denses
+        std::size_t enabledSize(void) const
+        {
+            return enabled;
+        }
+
+        bool isEnabled(Entity e) const
+        {
+            return has(e) && sparse[e.id()] < enabled;
+        }
+
+        // Un seul échange avec la frontière du préfixe actif
+        void setEnabled(Entity e, bool on)
+        {
+            if (!has(e) || isEnabled(e) == on)
+                return;
+            if (on)
+                swapSlots(sparse[e.id()], enabled++);
+            else
+                swapSlots(sparse[e.id()], --enabled);
+        }
+
+        Entity entityAt(std::size_t index) const
+        {
+            return denseEntities[index];
+        }
+
+        const T& valueAt(std::size_t index) const
+        {
+            return denseData[index];
+        }
+
+        T& valueAt(std::size_t index)
+        {
+            return denseData[index];
+        }
+
+        // Vide le storage en gardant sa capacité
+        void clear(void)
+        {
+            sparse.clear();
+            denseEntities.clear();
+            denseData.clear();
+            enabled = 0;
+        }
+
+        // Ajout en bloc d'entités qui n'ont pas encore le composant : une seule croissance
+        // par tableau, entités copiées d'un bloc, valeurs remplies en une passe contiguë.
+        // Renvoie l'indice dense du premier ajouté.
+        std::size_t appendBulk(const Entity* entities, std::size_t count, const T& value)
+        {
+            std::size_t base = denseData.size();
+            if (count == 0)
+                return base;
+            ensureAll(entities, count);
+            denseEntities.insert(denseEntities.end(), entities, entities + count);
+            denseData.insert(denseData.end(), count, value);
+            return enableAppended(entities, base, count);
+        }
+
+        // Comme appendBulk, chaque valeur est déplacée depuis source(i) -> T&, lue directement
+        // dans le storage d'origine (Registry::migrate) : un seul déplacement par valeur
+        template <typename Source>
+        std::size_t appendMoved(const Entity* entities, std::size_t count, Source&& source)
+        {
+            std::size_t base = denseData.size();
+            if (count == 0)
+                return base;
+            ensureAll(entities, count);
+            denseEntities.insert(denseEntities.end(), entities, entities + count);
+            denseData.reserve(base + count);
+            for (std::size_t i = 0; i < count; i++)
+                denseData.push_back(std::move(source(i)));
+            return enableAppended(entities, base, count);
+        }
+};
+
+// === Tag Storage : composant vide, seul l'ensemble d'entités est gardé ===
+// get() renvoie une instance statique partagée, aucune donnée n'est copiée ni déplacée.
+
+template <typename T>
+class ComponentStorage<T, true>
+{
+    private:
+
+        static constexpr std::size_t INVALID = static_cast<std::size_t>(-1);
+        std::vector<std::size_t> sparse;
+        std::vector<Entity> denseEntities;
+        std::size_t enabled = 0;
+
+        static T& instance(void)
+        {
+            static T tag;
+            return tag;
+        }
+
+        void ensure(const std::size_t& id)
+        {
+            if (id >= sparse.size())
+                sparse.resize(id + 1, INVALID);
+        }
+
+        void swapSlots(std::size_t a, std::size_t b)
+        {
+            if (a == b)
+                return;
+            std::swap(denseEntities[a], denseEntities[b]);
+            sparse[denseEntities[a].id()] = a;
+            sparse[denseEntities[b].id()] = b;
+        }
+
+        void fill(std::size_t index, std::size_t from)
+        {
+            if (index == from)
+                return;
+            denseEntities[index] = denseEntities[from];
+            sparse[denseEntities[index].id()] = index;
+        }
+
+    public:
+
+        virtual ~ComponentStorage(void) = default;
+
+        bool has(Entity e) const
+        {
+            return e.id() < sparse.size() && sparse[e.id()] != INVALID && denseEntities[sparse[e.id()]].id() == e.id();
+        }
+
+        T& emplace(Entity e, const T&)
+        {
+            ensure(e.id());
+            if (!has(e))
+            {
+                sparse[e.id()] = denseEntities.size();
+                denseEntities.push_back(e);
+                swapSlots(denseEntities.size() - 1, enabled++);
+            }
+            return instance();
+        }
+
+        void remove(Entity e)
+        {
+            if (!has(e))
+                return;
+            std::size_t index = sparse[e.id()];
+            if (index < enabled)
+            {
+                fill(index, --enabled);
+                index = enabled;
+            }
+            fill(index, denseEntities.size() - 1);
+            denseEntities.pop_back();
+            sparse[e.id()] = INVALID;
+        }
+
+        T& get(Entity)
+        {
+            return instance();
+        }
+
+        const T& get(Entity) const
+        {
+            return instance();
         }
 
         std::vector<Entity> entities(void) const
         {
             return denseEntities;
         }
-};
\ No newline at end of file
+
+        std::size_t size(void) const
+        {
+            return denseEntities.size();
+        }
+
+        std::size_t enabledSize(void) const
+        {
+            return enabled;
+        }
+
+        bool isEnabled(Entity e) const
+        {
+            return has(e) && sparse[e.id()] < enabled;
+        }
+
+        void setEnabled(Entity e, bool on)
+        {
+            if (!has(e) || isEnabled(e) == on)
+                return;
+            if (on)
+                swapSlots(sparse[e.id()], enabled++);
+            else
+                swapSlots(sparse[e.id()], --enabled);
+        }
+
+        Entity entityAt(std::size_t index) const
+        {
+            return denseEntities[index];
+        }
+
+        const T& valueAt(std::size_t) const
+        {
+            return instance();
+        }
+
+        T& valueAt(std::size_t)
+        {
+            return instance();
+        }
+
+        void clear(void)
+        {
+            sparse.clear();
+            denseEntities.clear();
+            enabled = 0;
+        }
+
+        template <typename Source>
+        std::size_t appendMoved(const Entity* entities, std::size_t count, Source&&)
+        {
+            return appendBulk(entities, count, instance());
+        }
+
+        std::size_t appendBulk(const Entity* entities, std::size_t count, const T&)
+        {
+            std::size_t base = denseEntities.size();
+            if (count == 0)
+                return base;
+            std::uint32_t maxId = 0;
+            for (std::size_t i = 0; i < count; i++)
+                maxId = std::max(maxId, entities[i].id());
+            ensure(maxId);
+            denseEntities.insert(denseEntities.end(), entities, entities + count);
+            for (std::size_t i = 0; i < count; i++)
+                sparse[entities[i].id()] = base + i;
+            std::size_t first = enabled;
+            if (first != base)
+            {
+                std::rotate(denseEntities.begin() + first, denseEntities.begin() + base, denseEntities.end());
+                for (std::size_t i = first; i < denseEntities.size(); i++)
+                    sparse[denseEntities[i].id()] = i;
+            }
+            enabled += count;
+            return first;
+        }
+};
+
+// === StorageTraits : choix du storage par type de composant ===
+// Spécialisable par l'utilisateur avant l'instanciation du Registry, ex :
+// template <> struct StorageTraits<Mesh> { using type = StableComponentStorage<Mesh>; };
+
+template <typename T>
+struct StorageTraits
+{
+    using type = ComponentStorage<T>;
+};
+
+template <typename T>
+using StorageOf = typename StorageTraits<T>::type;
\ No newline at end of file
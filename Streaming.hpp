@@ -0,0 +1,535 @@
+#pragma once
+
+#include "Registry.hpp"
+#include "ThreadPool.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// === StreamTraits : sérialisation d'un composant dans un fichier de cellule ===
+// Par défaut les composants trivialement copiables sont copiés octet par octet ; les autres
+// demandent une spécialisation (enabled, write, read) ou NotStreamed<T> pour être perdus au
+// déchargement. Les InternedFields sont suivis de leur texte, réinterné dans le registry au commit.
+
+template <typename T>
+struct StreamTraits
+{
+    static constexpr bool enabled = std::is_trivially_copyable_v<T>;
+
+    static void write(std::vector<char>& out, const T& value)
+    {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(T));
+    }
+
+    static bool read(const char*& in, const char* end, T& value)
+    {
+        if (static_cast<std::size_t>(end - in) < sizeof(T))
+            return false;
+        std::memcpy(&value, in, sizeof(T));
+        in += sizeof(T);
+        return true;
+    }
+};
+
+// Abandon explicite au déchargement : template <> struct NotStreamed<Task> : std::true_type {};
+template <typename T>
+struct NotStreamed : std::false_type {};
+
+struct StreamStats
+{
+    std::uint64_t cellsLoaded = 0;
+    std::uint64_t cellsUnloaded = 0;
+    std::uint64_t failedLoads = 0;
+    std::uint64_t failedUnloads = 0;    // écriture ratée : entités restaurées depuis la mémoire
+    std::uint64_t entitiesLoaded = 0;
+    std::uint64_t entitiesUnloaded = 0;
+    std::uint64_t bytesRead = 0;
+    std::uint64_t bytesWritten = 0;
+    double loadUs = 0.0;        // demande de chargement -> fin du commit
+    double maxLoadUs = 0.0;
+    double ioUs = 0.0;          // lecture + décodage ou écriture, sur le thread I/O
+    double commitUs = 0.0;
+    double maxCommitUs = 0.0;
+    double lastCommitUs = 0.0;
+};
+
+// === WorldStreamer : cellules du monde déchargées sur disque et rechargées en fond ===
+// unload() sérialise une cellule en mémoire puis détruit ses entités ; l'écriture du fichier,
+// la lecture et le décodage tournent sur un thread I/O dédié. commit(), appelé en début de
+// frame, fusionne les cellules prêtes dans le registry avec de nouveaux handles : il ne
+// bloque jamais sur le disque. Une écriture ratée restaure la cellule depuis la mémoire au
+// commit suivant. Les relations parent / enfant ne sont pas conservées.
+
+template <typename ComponentList>
+class WorldStreamer;
+
+template <typename... Cs>
+class WorldStreamer<TypeList<Cs...>>
+{
+    public:
+
+        using CellId = std::uint64_t;
+        using Remap = std::vector<std::pair<Entity, Entity>>;
+
+        enum class CellState
+        {
+            Resident,
+            Unloading,
+            OnDisk,
+            Loading
+        };
+
+    private:
+
+        using Clock = std::chrono::steady_clock;
+        using RegistryT = Registry<TypeList<Cs...>>;
+
+        static constexpr std::uint32_t MAGIC = 0x43534345; // "ECSC"
+        static constexpr std::uint32_t FORMAT = 2;
+        static constexpr CellId NO_CELL = ~CellId(0);
+
+        struct Completion
+        {
+            bool loaded = false;
+            bool ok = false;
+            CellId cell = 0;
+            std::size_t bytes = 0;
+            std::vector<Entity> entities;
+            IndexedTuple<std::vector<std::pair<std::uint32_t, Cs>>...> columns;
+            std::vector<std::string> texts;     // InternedFields, dans l'ordre des lignes
+            std::shared_ptr<const std::vector<char>> payload;   // déchargement : gardé jusqu'au commit
+            Clock::time_point requested;
+            Clock::time_point ioStart;
+            Clock::time_point ioEnd;
+        };
+
+        std::string _directory;
+        std::unordered_map<CellId, std::vector<Entity>> _members;
+        std::unordered_map<CellId, CellState> _states;
+        std::vector<CellId> _cellOf;
+        std::function<void(CellId, const Remap&)> _onLoad;
+        std::size_t _commitBudget = static_cast<std::size_t>(-1);
+        StreamStats _stats;
+        Remap _remap;
+        std::mutex _mutex;
+        std::vector<Completion> _ready;
+        std::atomic<std::size_t> _inFlight {0};
+        ThreadPool _io {1};
+
+        static double micros(Clock::duration d)
+        {
+            return std::chrono::duration<double, std::micro>(d).count();
+        }
+
+        template <typename U>
+        static void put(std::vector<char>& out, const U& value)
+        {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            out.insert(out.end(), bytes, bytes + sizeof(U));
+        }
+
+        template <typename U>
+        static bool take(const char*& in, const char* end, U& value)
+        {
+            if (static_cast<std::size_t>(end - in) < sizeof(U))
+                return false;
+            std::memcpy(&value, in, sizeof(U));
+            in += sizeof(U);
+            return true;
+        }
+
+        std::string path(CellId cell) const
+        {
+            return _directory + "/cell_" + std::to_string(cell) + ".ecsc";
+        }
+
+        // En-tête, handles d'origine, puis une colonne (indice local, valeur[, textes]) par composant
+        std::vector<char> serialize(RegistryT& reg, const std::vector<Entity>& entities) const
+        {
+            std::vector<char> out;
+            put(out, MAGIC);
+            put(out, FORMAT);
+            put(out, static_cast<std::uint64_t>(entities.size()));
+            for (Entity e : entities)
+                put(out, e);
+            StaticForEach<TypeList<Cs...>>([&](auto tag) {
+                using T = typename decltype(tag)::type;
+                std::uint64_t count = 0;
+                std::size_t countAt = out.size();
+                put(out, count);
+                if constexpr (StreamTraits<T>::enabled)
+                {
+                    const auto& pool = std::as_const(reg).template storage<T>();
+                    for (std::size_t i = 0; i < entities.size(); i++)
+                    {
+                        if (!pool.has(entities[i]))
+                            continue;
+                        put(out, static_cast<std::uint32_t>(i));
+                        StreamTraits<T>::write(out, pool.get(entities[i]));
+                        if constexpr (hasInternedFields<T>)
+                        {
+                            forEachInterned(pool.get(entities[i]), [&](InternedString handle) {
+                                std::string_view text = reg.strings().view(handle);
+                                put(out, static_cast<std::uint32_t>(text.size()));
+                                out.insert(out.end(), text.begin(), text.end());
+                            });
+                        }
+                        count++;
+                    }
+                    std::memcpy(out.data() + countAt, &count, sizeof(count));
+                }
+            });
+            return out;
+        }
+
+        static bool deserialize(const std::vector<char>& bytes, Completion& done)
+        {
+            const char* in = bytes.data();
+            const char* end = in + bytes.size();
+            std::uint32_t magic = 0;
+            std::uint32_t format = 0;
+            std::uint64_t count = 0;
+            if (!take(in, end, magic) || !take(in, end, format) || !take(in, end, count) || magic != MAGIC || format != FORMAT)
+                return false;
+            if (count > static_cast<std::size_t>(end - in) / sizeof(Entity))
+                return false;
+            done.entities.resize(count);
+            for (auto& e : done.entities)
+                take(in, end, e);
+            bool ok = true;
+            StaticForEach<TypeList<Cs...>>([&](auto tag) {
+                using T = typename decltype(tag)::type;
+                std::uint64_t rows = 0;
+                if (!ok || !take(in, end, rows))
+                {
+                    ok = false;
+                    return;
+                }
+                if constexpr (StreamTraits<T>::enabled)
+                {
+                    auto& column = slotAt<IndexOf<T, TypeList<Cs...>>::value>(done.columns);
+                    for (std::uint64_t r = 0; r < rows && ok; r++)
+                    {
+                        std::pair<std::uint32_t, T> row {};
+                        ok = take(in, end, row.first) && row.first < count && StreamTraits<T>::read(in, end, row.second);
+                        if constexpr (hasInternedFields<T>)
+                        {
+                            for (std::size_t f = 0; f < std::tuple_size_v<InternedHandles<T>> && ok; f++)
+                            {
+                                std::uint32_t size = 0;
+                                ok = take(in, end, size) && size <= static_cast<std::size_t>(end - in);
+                                if (ok)
+                                {
+                                    done.texts.emplace_back(in, size);
+                                    in += size;
+                                }
+                            }
+                        }
+                        if (ok)
+                            column.push_back(std::move(row));
+                    }
+                }
+                else
+                    ok = rows == 0;
+            });
+            return ok;
+        }
+
+        void writeFile(Completion& done, const std::vector<char>& bytes) const
+        {
+            int fd = ::open(path(done.cell).c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (fd < 0)
+                return;
+            std::size_t offset = 0;
+            while (offset < bytes.size())
+            {
+                ssize_t n = ::write(fd, bytes.data() + offset, bytes.size() - offset);
+                if (n <= 0)
+                    break;
+                offset += static_cast<std::size_t>(n);
+            }
+            done.ok = ::close(fd) == 0 && offset == bytes.size();
+            done.bytes = offset;
+        }
+
+        void readFile(Completion& done) const
+        {
+            int fd = ::open(path(done.cell).c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+                return;
+            struct stat st;
+            std::vector<char> bytes;
+            if (::fstat(fd, &st) == 0)
+                bytes.resize(static_cast<std::size_t>(st.st_size));
+            std::size_t offset = 0;
+            while (offset < bytes.size())
+            {
+                ssize_t n = ::read(fd, bytes.data() + offset, bytes.size() - offset);
+                if (n <= 0)
+                    break;
+                offset += static_cast<std::size_t>(n);
+            }
+            ::close(fd);
+            done.bytes = offset;
+            done.ok = offset == bytes.size() && deserialize(bytes, done);
+        }
+
+        void finish(Completion&& done)
+        {
+            done.ioEnd = Clock::now();
+            std::lock_guard<std::mutex> lock(_mutex);
+            _ready.push_back(std::move(done));
+        }
+
+        void track(Entity e, CellId cell)
+        {
+            if (e.id() >= _cellOf.size())
+                _cellOf.resize(e.id() + 1, NO_CELL);
+            _cellOf[e.id()] = cell;
+        }
+
+        void merge(RegistryT& reg, Completion& done)
+        {
+            std::vector<Entity>& members = _members[done.cell];
+            _remap.clear();
+            for (Entity old : done.entities)
+            {
+                Entity e = reg.create();
+                _remap.emplace_back(old, e);
+                members.push_back(e);
+                track(e, done.cell);
+            }
+            // Les handles lus sont périmés : chaque champ reprend une référence sur son texte
+            std::size_t text = 0;
+            StaticForEach<TypeList<Cs...>>([&](auto tag) {
+                using T = typename decltype(tag)::type;
+                for (auto& row : slotAt<IndexOf<T, TypeList<Cs...>>::value>(done.columns))
+                {
+                    if constexpr (hasInternedFields<T>)
+                        forEachInterned(row.second, [&](InternedString& handle) { handle = reg.strings().intern(done.texts[text++]); });
+                    reg.template add<T>(_remap[row.first].second, std::move(row.second));
+                }
+            });
+            _states[done.cell] = CellState::Resident;
+            if (_onLoad)
+                _onLoad(done.cell, _remap);
+        }
+
+        // L'écriture a échoué : les entités sont recréées depuis les octets gardés en mémoire,
+        // onLoad reçoit les nouveaux handles comme pour un chargement
+        void restore(RegistryT& reg, Completion& c)
+        {
+            _stats.failedUnloads++;
+            c.entities.clear();
+            if (!deserialize(*c.payload, c))
+            {
+                _states[c.cell] = CellState::OnDisk;
+                return;
+            }
+            merge(reg, c);
+        }
+
+    public:
+
+        explicit WorldStreamer(const std::string& directory) : _directory(directory)
+        {
+            static_assert(((StreamTraits<Cs>::enabled || NotStreamed<Cs>::value) && ...),
+                "WorldStreamer: specialize StreamTraits<T> or NotStreamed<T> for every component that is not trivially copyable");
+        }
+
+        // Le thread I/O termine les écritures en cours avant la destruction des membres
+        virtual ~WorldStreamer(void) = default;
+
+        WorldStreamer(const WorldStreamer&) = delete;
+        WorldStreamer& operator=(const WorldStreamer&) = delete;
+
+        // Clé de cellule pour un découpage spatial en grille
+        static CellId cellAt(std::int32_t x, std::int32_t y)
+        {
+            return (static_cast<CellId>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+        }
+
+        void assign(Entity e, CellId cell)
+        {
+            track(e, cell);
+            _members[cell].push_back(e);
+            _states.emplace(cell, CellState::Resident);
+        }
+
+        CellId cellOf(Entity e) const
+        {
+            return e.id() < _cellOf.size() ? _cellOf[e.id()] : NO_CELL;
+        }
+
+        CellState state(CellId cell) const
+        {
+            auto it = _states.find(cell);
+            return it != _states.end() ? it->second : CellState::OnDisk;
+        }
+
+        // Sérialise et détruit les entités de la cellule, l'écriture part sur le thread I/O
+        bool unload(RegistryT& reg, CellId cell)
+        {
+            auto it = _members.find(cell);
+            if (it == _members.end() || state(cell) != CellState::Resident)
+                return false;
+            std::vector<Entity> entities;
+            entities.reserve(it->second.size());
+            for (Entity e : it->second)
+            {
+                if (reg.valid(e) && cellOf(e) == cell)
+                    entities.push_back(e);
+            }
+            _members.erase(it);
+            Completion done;
+            done.cell = cell;
+            done.payload = std::make_shared<const std::vector<char>>(serialize(reg, entities));
+            for (Entity e : entities)
+            {
+                _cellOf[e.id()] = NO_CELL;
+                reg.destroy(e);
+            }
+            _states[cell] = CellState::Unloading;
+            done.entities = std::move(entities);
+            done.requested = Clock::now();
+            _inFlight++;
+            _io.submit([this, done = std::move(done)]() mutable {
+                done.ioStart = Clock::now();
+                writeFile(done, *done.payload);
+                finish(std::move(done));
+            });
+            return true;
+        }
+
+        // Demande le chargement ; une écriture encore en cours de la même cellule passe avant
+        bool load(CellId cell)
+        {
+            CellState current = state(cell);
+            if (current == CellState::Resident || current == CellState::Loading)
+                return false;
+            _states[cell] = CellState::Loading;
+
+            Completion done;
+            done.loaded = true;
+            done.cell = cell;
+            done.requested = Clock::now();
+            _inFlight++;
+            _io.submit([this, done = std::move(done)]() mutable {
+                done.ioStart = Clock::now();
+                readFile(done);
+                finish(std::move(done));
+            });
+            return true;
+        }
+
+        // Début de frame, thread de simulation : fusionne au plus commitBudget cellules prêtes
+        std::size_t commit(RegistryT& reg)
+        {
+            std::vector<Completion> batch;
+            std::vector<Completion> later;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_ready.empty())
+                    return 0;
+                std::size_t count = 0;
+                for (auto& c : _ready)
+                {
+                    bool merge = c.loaded && c.ok;
+                    if (merge && count >= _commitBudget)
+                        later.push_back(std::move(c));
+                    else
+                    {
+                        count += merge;
+                        batch.push_back(std::move(c));
+                    }
+                }
+                _ready.swap(later);
+            }
+
+            Clock::time_point start = Clock::now();
+            std::size_t merged = 0;
+            for (auto& c : batch)
+            {
+                _inFlight--;
+                _stats.ioUs += micros(c.ioEnd - c.ioStart);
+                if (!c.loaded)
+                {
+                    _stats.bytesWritten += c.bytes;
+                    if (c.ok)
+                    {
+                        _stats.cellsUnloaded++;
+                        _stats.entitiesUnloaded += c.entities.size();
+                        if (state(c.cell) == CellState::Unloading)
+                            _states[c.cell] = CellState::OnDisk;
+                    }
+                    else
+                        restore(reg, c);
+                    continue;
+                }
+                _stats.bytesRead += c.bytes;
+                // Cellule restaurée après un échec d'écriture : le fichier lu est périmé
+                if (state(c.cell) != CellState::Loading)
+                    continue;
+                if (!c.ok)
+                {
+                    _stats.failedLoads++;
+                    _states[c.cell] = CellState::OnDisk;
+                    continue;
+                }
+                merge(reg, c);
+                _stats.cellsLoaded++;
+                _stats.entitiesLoaded += c.entities.size();
+                merged++;
+                double latency = micros(Clock::now() - c.requested);
+                _stats.loadUs += latency;
+                _stats.maxLoadUs = std::max(_stats.maxLoadUs, latency);
+            }
+            double cost = micros(Clock::now() - start);
+            _stats.lastCommitUs = cost;
+            _stats.commitUs += cost;
+            _stats.maxCommitUs = std::max(_stats.maxCommitUs, cost);
+            return merged;
+        }
+
+        // onLoad(cellule, [(ancien handle, nouveau handle)]) : corriger les références entre entités
+        void onLoad(std::function<void(CellId, const Remap&)> fnc)
+        {
+            _onLoad = std::move(fnc);
+        }
+
+        void setCommitBudget(std::size_t cells)
+        {
+            _commitBudget = cells;
+        }
+
+        std::size_t inFlight(void) const
+        {
+            return _inFlight;
+        }
+
+        // Bloque jusqu'à la fin des I/O en cours : arrêt ou tests, jamais dans la boucle de frame
+        void waitIdle(void)
+        {
+            _io.wait();
+        }
+
+        const StreamStats& stats(void) const
+        {
+            return _stats;
+        }
+};
\ No newline at end of file
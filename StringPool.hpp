@@ -0,0 +1,301 @@
+#pragma once
+
+#include "Storage.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// === InternedString : handle 4 octets vers une chaîne (ou un blob) d'un StringPool ===
+// 24 bits d'index, 8 bits de génération : un handle relâché puis réutilisé ne résout plus.
+// Le handle nul est la chaîne vide, toujours valide. Trivialement copiable : un composant qui
+// ne contient que des handles reste éligible aux chemins memcpy.
+
+struct InternedString
+{
+    using Layout = EntityLayout<std::uint32_t, 24>;
+
+    std::uint32_t raw = 0;
+
+    constexpr InternedString(void) = default;
+    constexpr InternedString(std::uint32_t index, std::uint32_t generation)
+        : raw(((generation & Layout::VERSION_MASK) << Layout::ID_BITS) | (index & Layout::ID_MASK)) {}
+
+    constexpr std::uint32_t index(void) const
+    {
+        return raw & Layout::ID_MASK;
+    }
+
+    constexpr std::uint32_t generation(void) const
+    {
+        return raw >> Layout::ID_BITS;
+    }
+
+    constexpr bool empty(void) const
+    {
+        return raw == 0;
+    }
+
+    constexpr bool operator==(const InternedString& other) const
+    {
+        return raw == other.raw;
+    }
+
+    constexpr bool operator!=(const InternedString& other) const
+    {
+        return raw != other.raw;
+    }
+};
+
+static_assert(sizeof(InternedString) == 4, "InternedString must stay a 4-byte handle");
+
+// === StringPool : arène de chaînes dédoublonnées et comptées ===
+// Les octets vivent dans des blocs jamais déplacés : une string_view reste valide tant que la
+// chaîne est référencée et que compact() n'est pas appelé. intern() d'une chaîne déjà présente
+// renvoie le même handle et ajoute une référence ; release() la rend, et la chaîne disparaît à
+// zéro. Ses octets restent dans l'arène jusqu'au prochain compact().
+
+class StringPool
+{
+    private:
+
+        static constexpr std::size_t CHUNK_BYTES = 1 << 16;
+        static constexpr std::uint32_t MAX_ENTRIES = InternedString::Layout::ID_MASK;
+
+        struct Entry
+        {
+            const char* data = "";
+            std::uint32_t size = 0;
+            std::uint32_t refs = 0;
+            std::uint32_t generation = 0;
+        };
+
+        std::vector<std::unique_ptr<char[]>> _chunks;
+        char* _cursor = nullptr;
+        std::size_t _left = 0;
+        std::vector<Entry> _entries {Entry {}};
+        std::vector<std::uint32_t> _free;
+        std::unordered_map<std::string_view, std::uint32_t> _lookup;
+        std::size_t _liveBytes = 0;
+        std::size_t _deadBytes = 0;
+
+        // Les chaînes plus grandes qu'un bloc ont leur propre bloc, le bloc courant continue
+        const char* store(std::string_view bytes)
+        {
+            if (bytes.size() >= CHUNK_BYTES)
+            {
+                _chunks.push_back(std::unique_ptr<char[]>(new char[bytes.size()]));
+                std::memcpy(_chunks.back().get(), bytes.data(), bytes.size());
+                return _chunks.back().get();
+            }
+            if (bytes.size() > _left)
+            {
+                _chunks.push_back(std::unique_ptr<char[]>(new char[CHUNK_BYTES]));
+                _cursor = _chunks.back().get();
+                _left = CHUNK_BYTES;
+            }
+            char* ptr = _cursor;
+            std::memcpy(ptr, bytes.data(), bytes.size());
+            _cursor += bytes.size();
+            _left -= bytes.size();
+            return ptr;
+        }
+
+        static std::uint32_t nextGeneration(std::uint32_t generation)
+        {
+            std::uint32_t next = (generation + 1) & InternedString::Layout::VERSION_MASK;
+            return next == 0 ? 1 : next;
+        }
+
+        void drop(std::uint32_t index)
+        {
+            Entry& entry = _entries[index];
+            _lookup.erase(std::string_view(entry.data, entry.size));
+            _liveBytes -= entry.size;
+            _deadBytes += entry.size;
+            entry.refs = 0;
+            entry.generation = nextGeneration(entry.generation);
+            _free.push_back(index);
+        }
+
+    public:
+
+        StringPool(void) = default;
+        virtual ~StringPool(void) = default;
+
+        StringPool(const StringPool&) = delete;
+        StringPool& operator=(const StringPool&) = delete;
+
+        // Une référence de plus sur le handle renvoyé ; pool plein : handle nul
+        InternedString intern(std::string_view text)
+        {
+            if (text.empty())
+                return InternedString {};
+            auto it = _lookup.find(text);
+            if (it != _lookup.end())
+            {
+                Entry& entry = _entries[it->second];
+                entry.refs++;
+                return InternedString {it->second, entry.generation};
+            }
+            std::uint32_t index;
+            if (!_free.empty())
+            {
+                index = _free.back();
+                _free.pop_back();
+            }
+            else
+            {
+                if (_entries.size() >= MAX_ENTRIES)
+                    return InternedString {};
+                index = static_cast<std::uint32_t>(_entries.size());
+                _entries.push_back(Entry {"", 0, 0, 1});
+            }
+            Entry& entry = _entries[index];
+            entry.data = store(text);
+            entry.size = static_cast<std::uint32_t>(text.size());
+            entry.refs = 1;
+            _lookup.emplace(std::string_view(entry.data, entry.size), index);
+            _liveBytes += entry.size;
+            return InternedString {index, entry.generation};
+        }
+
+        InternedString internBlob(const void* data, std::size_t size)
+        {
+            return intern(std::string_view(static_cast<const char*>(data), size));
+        }
+
+        // Handle existant sans nouvelle référence, handle nul si absent
+        InternedString find(std::string_view text) const
+        {
+            auto it = _lookup.find(text);
+            if (it == _lookup.end())
+                return InternedString {};
+            return InternedString {it->second, _entries[it->second].generation};
+        }
+
+        bool valid(InternedString s) const
+        {
+            if (s.empty())
+                return true;
+            return s.index() < _entries.size() && _entries[s.index()].generation == s.generation() && _entries[s.index()].refs > 0;
+        }
+
+        void retain(InternedString s, std::uint32_t count = 1)
+        {
+            if (!s.empty() && valid(s))
+                _entries[s.index()].refs += count;
+        }
+
+        void release(InternedString s)
+        {
+            if (!s.empty() && valid(s) && --_entries[s.index()].refs == 0)
+                drop(s.index());
+        }
+
+        // Vue sans copie sur les octets de l'arène ; vide si le handle est périmé
+        std::string_view view(InternedString s) const
+        {
+            if (!valid(s))
+                return std::string_view();
+            const Entry& entry = _entries[s.index()];
+            return std::string_view(entry.data, entry.size);
+        }
+
+        std::uint32_t refs(InternedString s) const
+        {
+            return valid(s) && !s.empty() ? _entries[s.index()].refs : 0;
+        }
+
+        // Chaînes distinctes vivantes
+        std::size_t size(void) const
+        {
+            return _entries.size() - 1 - _free.size();
+        }
+
+        std::size_t liveBytes(void) const
+        {
+            return _liveBytes;
+        }
+
+        // Octets de chaînes relâchées, récupérés par compact()
+        std::size_t deadBytes(void) const
+        {
+            return _deadBytes;
+        }
+
+        // Recopie les chaînes vivantes dans des blocs neufs et libère les anciens. Les handles
+        // restent valides, les string_view obtenues avant l'appel ne le sont plus.
+        void compact(void)
+        {
+            std::vector<std::unique_ptr<char[]>> old;
+            old.swap(_chunks);
+            _cursor = nullptr;
+            _left = 0;
+            _lookup.clear();
+            for (std::uint32_t index = 1; index < _entries.size(); index++)
+            {
+                Entry& entry = _entries[index];
+                if (entry.refs == 0)
+                    continue;
+                entry.data = store(std::string_view(entry.data, entry.size));
+                _lookup.emplace(std::string_view(entry.data, entry.size), index);
+            }
+            _deadBytes = 0;
+        }
+
+        // Relâche toutes les chaînes : les handles existants deviennent périmés
+        void clear(void)
+        {
+            for (std::uint32_t index = 1; index < _entries.size(); index++)
+            {
+                if (_entries[index].refs > 0)
+                    drop(index);
+            }
+            _chunks.clear();
+            _cursor = nullptr;
+            _left = 0;
+            _liveBytes = 0;
+            _deadBytes = 0;
+        }
+};
+
+// === InternedFields : champs InternedString possédés par un composant ===
+// Le Registry rend leurs références au retrait du composant, en prend une par instance de
+// prefab et les réinterne dans la cible d'une migration ou au rechargement d'une cellule
+// streamée. À spécialiser :
+// template <> struct InternedFields<Task> { static constexpr auto members = std::make_tuple(&Task::description); };
+
+template <typename T>
+struct InternedFields
+{
+    static constexpr auto members = std::tuple<>{};
+};
+
+template <typename T>
+constexpr bool hasInternedFields = std::tuple_size_v<std::decay_t<decltype(InternedFields<T>::members)>> != 0;
+
+// fnc(InternedString&) ou fnc(const InternedString&) selon la constance de value
+template <typename T, typename Func>
+void forEachInterned(T& value, Func&& fnc)
+{
+    std::apply([&](auto... members) { (fnc(value.*members), ...); }, InternedFields<std::remove_const_t<T>>::members);
+}
+
+template <typename T>
+using InternedHandles = std::array<InternedString, std::tuple_size_v<std::decay_t<decltype(InternedFields<T>::members)>>>;
+
+template <typename T>
+InternedHandles<T> internedHandles(const T& value)
+{
+    InternedHandles<T> handles {};
+    std::size_t i = 0;
+    forEachInterned(value, [&](InternedString text) { handles[i++] = text; });
+    return handles;
+}
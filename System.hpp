@@ -1,7 +1,12 @@
 #pragma once
 
 #include "TypeList.hpp"
+#include "Jobs.hpp"
 #include <memory>
+#include <chrono>
+#include <cstdint>
+#include <cmath>
+#include <string>
 
 // === Systèmes ===
 
@@ -23,12 +28,111 @@ struct SystemTypeList<TypeList<Ts...>> : public System<Ts...>
     using Signature = TypeList<Ts...>;
 };
 
+// Système découpé : traite une tranche de sa requête par frame, sous budget
+template <typename... Ts>
+struct TimeSlicedSystem : public System<Ts...>
+{
+    using Signature = TypeList<Ts...>;
+
+    // Renvoie true quand la passe sur toutes les entités est terminée
+    virtual bool updateSlice(double, Registry<Signature>&, SliceCursor&) = 0;
+
+    void update(double dt, Registry<Signature>& reg) override
+    {
+        SliceCursor cursor;
+        updateSlice(dt, reg, cursor);
+    }
+};
+
+template <typename T>
+struct TimeSlicedTypeList;
+
+template <typename... Ts>
+struct TimeSlicedTypeList<TypeList<Ts...>> : public TimeSlicedSystem<Ts...>
+{
+    using Signature = TypeList<Ts...>;
+};
+
+template <typename SystemT, typename ComponentList>
+struct hasUpdateSlice
+{
+    private:
+
+        template <typename U>
+        static auto test(U*) -> decltype(std::declval<U*>()->updateSlice(0.0, std::declval<Registry<ComponentList>&>(), std::declval<SliceCursor&>()), std::true_type());
+
+        template <typename>
+        static auto test(...) -> std::false_type;
+
+    public:
+
+        static constexpr bool value = decltype(test<SystemT>(nullptr))::value;
+};
+
+// everyNFrames : une frame sur N, hz > 0 : cadence fixe, budgetUs > 0 : budget par frame
+struct SystemSchedule
+{
+    unsigned everyNFrames = 1;
+    double hz = 0.0;
+    double budgetUs = 0.0;
+};
+
+struct SystemStats
+{
+    std::uint64_t runs = 0;
+    std::uint64_t skipped = 0;
+    std::uint64_t passes = 0;
+    std::uint64_t overruns = 0;
+    double lastUs = 0.0;
+    double maxUs = 0.0;
+    double totalUs = 0.0;
+    double worstOverrunUs = 0.0;
+};
+
 struct ISystem
 {
     virtual ~ISystem(void) = default;
     virtual void update(double) = 0;
     virtual const char* name(void) const = 0;
     int priority = 0;
+    SystemSchedule schedule;
+    SystemStats stats;
+    double pendingDt = 0.0;
+
+    ISystem& everyNFrames(unsigned n)
+    {
+        schedule.everyNFrames = n ? n : 1;
+        return *this;
+    }
+
+    ISystem& atRate(double hz)
+    {
+        schedule.hz = hz;
+        return *this;
+    }
+
+    ISystem& withBudget(double us)
+    {
+        schedule.budgetUs = us;
+        return *this;
+    }
+
+    bool due(std::uint64_t frame) const
+    {
+        if (schedule.hz > 0.0)
+            return pendingDt * schedule.hz >= 1.0;
+        return (frame % schedule.everyNFrames) == 0;
+    }
+
+    // dt rendu au système : tout le temps accumulé, ou un multiple entier de la période
+    double consumeDt(void)
+    {
+        double dt = pendingDt;
+        if (schedule.hz > 0.0)
+            dt = std::floor(pendingDt * schedule.hz) / schedule.hz;
+        pendingDt -= dt;
+        return dt;
+    }
 };
 
 template <typename SystemT, typename ComponentList>
@@ -36,12 +140,33 @@ struct SystemWrapper : public ISystem
 {
     SystemT* _system;
     Registry<ComponentList>& _registry;
+    SliceCursor _cursor;
+    double _passDt = 0.0;
+    double _sincePassStart = 0.0;
 
     SystemWrapper(SystemT* sys, Registry<ComponentList>& reg) : _system(sys), _registry(reg) {}
 
     void update(double dt) override
     {
-        _system->update(dt, _registry);
+        if constexpr (hasUpdateSlice<SystemT, ComponentList>::value)
+        {
+            _sincePassStart += dt;
+            if (_cursor.next == 0)
+            {
+                _passDt = _sincePassStart;
+                _sincePassStart = 0.0;
+            }
+            _cursor.deadline = std::chrono::steady_clock::time_point::max();
+            if (schedule.budgetUs > 0.0)
+                _cursor.deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double, std::micro>(schedule.budgetUs));
+            if (_system->updateSlice(_passDt, _registry, _cursor))
+                stats.passes++;
+        }
+        else
+        {
+            _system->update(dt, _registry);
+            stats.passes++;
+        }
     }
 
     const char* name(void) const override
@@ -57,6 +182,24 @@ class SystemManager
     private:
 
         std::vector<std::unique_ptr<ISystem>> _systems;
+        std::uint64_t _frame = 0;
+        JobScheduler _jobs;
+
+        static void record(ISystem& s, double us)
+        {
+            SystemStats& st = s.stats;
+            st.runs++;
+            st.lastUs = us;
+            st.totalUs += us;
+            if (us > st.maxUs)
+                st.maxUs = us;
+            if (s.schedule.budgetUs > 0.0 && us > s.schedule.budgetUs)
+            {
+                st.overruns++;
+                if (us - s.schedule.budgetUs > st.worstOverrunUs)
+                    st.worstOverrunUs = us - s.schedule.budgetUs;
+            }
+        }
 
     public:
 
@@ -64,14 +207,16 @@ class SystemManager
         virtual ~SystemManager(void) = default;
 
         template <typename SystemT>
-        void addSystem(SystemT* sys, Registry<ComponentList>& reg, int priority = 0)
+        ISystem& addSystem(SystemT* sys, Registry<ComponentList>& reg, int priority = 0)
         {
             auto ptr = std::make_unique<SystemWrapper<SystemT, ComponentList>>(sys, reg);
             ptr->priority = priority;
+            ISystem& added = *ptr;
             _systems.push_back(std::move(ptr));
             std::sort(_systems.begin(), _systems.end(), [](const auto& a, const auto& b) {
                 return a->priority < b->priority;
             });
+            return added;
         }
 
         template <typename SystemT, typename... Args>
@@ -81,13 +226,54 @@ class SystemManager
             addSystem(sys, priority);
         }
 
-        void update(double dt, Registry<ComponentList>&)
+        void update(double dt, Registry<ComponentList>& reg)
         {
+            // Point de reprise des jobs asynchrones terminés, avant les systèmes
+            _jobs.drain([&reg](Entity e) { return reg.valid(e); });
             for (auto& s : _systems)
             {
+                s->pendingDt += dt;
+                if (!s->due(_frame))
+                {
+                    s->stats.skipped++;
+                    continue;
+                }
                 std::cout << " || System[" << s->name() << "] ";
-                s->update(dt);
+                auto start = std::chrono::steady_clock::now();
+                s->update(s->consumeDt());
+                auto end = std::chrono::steady_clock::now();
+                record(*s, std::chrono::duration<double, std::micro>(end - start).count());
+            }
+            _frame++;
+        }
+
+        JobScheduler& jobs(void)
+        {
+            return _jobs;
+        }
+
+        void clear(void)
+        {
+            _systems.clear();
+            _frame = 0;
+            _jobs.cancelPending();
+        }
+
+        const SystemStats* stats(const std::string& name) const
+        {
+            for (const auto& s : _systems)
+            {
+                if (name == s->name())
+                    return &s->stats;
             }
+            return nullptr;
+        }
+
+        template <typename Func>
+        void forEachStats(Func&& fnc) const
+        {
+            for (const auto& s : _systems)
+                fnc(s->name(), s->stats);
         }
 
         const std::vector<std::unique_ptr<System<ComponentList>>>& systems(void) const
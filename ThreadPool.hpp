@@ -0,0 +1,89 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <deque>
+
+// === ThreadPool ===
+
+class ThreadPool
+{
+    private:
+
+        std::vector<std::thread> _workers;
+        std::deque<std::function<void(void)>> _jobs;
+        std::mutex _mutex;
+        std::condition_variable _jobReady;
+        std::condition_variable _idle;
+        std::size_t _pending = 0;
+        bool _stop = false;
+
+        void work(void)
+        {
+            for (;;)
+            {
+                std::function<void(void)> job;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _jobReady.wait(lock, [this] { return _stop || !_jobs.empty(); });
+                    if (_stop && _jobs.empty())
+                        return;
+                    job = std::move(_jobs.front());
+                    _jobs.pop_front();
+                }
+                job();
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (--_pending == 0)
+                    _idle.notify_all();
+            }
+        }
+
+    public:
+
+        explicit ThreadPool(std::size_t count = std::thread::hardware_concurrency())
+        {
+            if (count == 0)
+                count = 1;
+            for (std::size_t i = 0; i < count; i++)
+                _workers.emplace_back([this] { work(); });
+        }
+
+        virtual ~ThreadPool(void)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _jobReady.notify_all();
+            for (auto& w : _workers)
+                w.join();
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        void submit(std::function<void(void)> job)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _jobs.push_back(std::move(job));
+                _pending++;
+            }
+            _jobReady.notify_one();
+        }
+
+        // Barrière : bloque jusqu'à ce que tous les jobs soumis soient terminés
+        void wait(void)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _idle.wait(lock, [this] { return _pending == 0; });
+        }
+
+        std::size_t size(void) const
+        {
+            return _workers.size();
+        }
+};
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <type_traits>
 #include <utility>
 
 // === Méta basé sur TypeList voir autre répo  ===
@@ -19,27 +20,108 @@ struct Front<TypeList<T, Ts...>>
     using type = T; 
 };
 
-template <typename TypeList, typename Func>
-struct StaticForEachImpl;
+// === Recherche d'indice sans récursion ===
+// IndexTable hérite à plat de IndexedType<i, Ti> : le compilateur déduit i depuis la base
+// correspondant à T, une instanciation par liste au lieu d'une par préfixe.
+
+template <std::size_t I, typename T>
+struct IndexedType {};
+
+template <typename Seq, typename... Ts>
+struct IndexTable;
+
+template <std::size_t... Is, typename... Ts>
+struct IndexTable<std::index_sequence<Is...>, Ts...> : IndexedType<Is, Ts>... {};
+
+template <typename T, std::size_t I>
+constexpr std::size_t indexIn(const IndexedType<I, T>*)
+{
+    return I;
+}
+
+// T absent (ou présent deux fois) : aucune base ne correspond
+template <typename T>
+constexpr std::size_t indexIn(const void*)
+{
+    return static_cast<std::size_t>(-1);
+}
 
-template <typename Func>
-struct StaticForEachImpl<TypeList<>, Func>
+template <typename T, typename List>
+struct IndexOf;
+
+template <typename T, typename... Ts>
+struct IndexOf<T, TypeList<Ts...>>
 {
-    static void apply(Func&&) {}
+    static constexpr std::size_t value = indexIn<T>(static_cast<const IndexTable<std::index_sequence_for<Ts...>, Ts...>*>(nullptr));
+    static_assert(value < sizeof...(Ts), "IndexOf: type not in TypeList (or listed twice)");
 };
 
-template <typename T, typename... Ts, typename Func>
-struct StaticForEachImpl<TypeList<T, Ts...>, Func>
+// === IndexedTuple : un membre par type, héritage à plat ===
+// Remplace std::tuple pour les longues listes : ni récursion d'héritage ni contraintes de
+// constructeur en O(n) par niveau ; accès par slotAt<I>().
+
+template <std::size_t I, typename T>
+struct IndexedSlot
+{
+    T value {};
+};
+
+template <typename Seq, typename... Ts>
+struct IndexedTupleImpl;
+
+template <std::size_t... Is, typename... Ts>
+struct IndexedTupleImpl<std::index_sequence<Is...>, Ts...> : IndexedSlot<Is, Ts>... {};
+
+template <typename... Ts>
+using IndexedTuple = IndexedTupleImpl<std::index_sequence_for<Ts...>, Ts...>;
+
+template <std::size_t I, typename T>
+T& slotAt(IndexedSlot<I, T>& slot)
+{
+    return slot.value;
+}
+
+template <std::size_t I, typename T>
+const T& slotAt(const IndexedSlot<I, T>& slot)
+{
+    return slot.value;
+}
+
+template <typename T, typename List>
+struct Contains;
+
+template <typename T, typename... Ts>
+struct Contains<T, TypeList<Ts...>>
+{
+    static constexpr bool value = (std::is_same_v<T, Ts> || ...);
+};
+
+// Tous les types de List figurent dans Of
+template <typename List, typename Of>
+struct ContainsAll;
+
+template <typename... Ts, typename Of>
+struct ContainsAll<TypeList<Ts...>, Of>
+{
+    static constexpr bool value = (Contains<Ts, Of>::value && ...);
+};
+
+template <typename List>
+struct StaticForEachImpl;
+
+// Expression de repli : une fonction par appel, quelle que soit la taille de la liste
+template <typename... Ts>
+struct StaticForEachImpl<TypeList<Ts...>>
 {
-    static void apply(Func&& fnc)
+    template <typename Func>
+    static void apply(Func& fnc)
     {
-        fnc(TypeTag<T>{});
-        StaticForEachImpl<TypeList<Ts...>, Func>::apply(std::forward<Func>(fnc));
+        (fnc(TypeTag<Ts>{}), ...);
     }
 };
 
 template <typename List, typename Func>
 void StaticForEach(Func&& fnc) 
 {
-    StaticForEachImpl<List, Func>::apply(std::forward<Func>(fnc));
+    StaticForEachImpl<List>::apply(fnc);
 }
\ No newline at end of file
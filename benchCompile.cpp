@@ -0,0 +1,85 @@
+#include "ECS.hpp"
+#include <chrono>
+#include <utility>
+
+// Coût de compilation en fonction de la taille de la liste de composants :
+// for n in 50 200 500; do time g++ -std=c++17 -pthread -DBENCH_COMPONENTS=$n benchCompile.cpp -o benchCompile && ./benchCompile; done
+
+#ifndef BENCH_COMPONENTS
+    #define BENCH_COMPONENTS 50
+#endif
+
+template <std::size_t N>
+struct Comp
+{
+    std::uint32_t value = N;
+};
+
+template <std::size_t... Is>
+TypeList<Comp<Is>...> makeComponents(std::index_sequence<Is...>);
+
+using Components = decltype(makeComponents(std::make_index_sequence<BENCH_COMPONENTS>{}));
+using First = Comp<0>;
+using Middle = Comp<BENCH_COMPONENTS / 2>;
+using Last = Comp<BENCH_COMPONENTS - 1>;
+
+class SumSystem : public SystemTypeList<Components>
+{
+    public:
+
+        std::uint64_t sum = 0;
+
+        void update(double, Registry<Signature>& reg) override
+        {
+            reg.template forEachEntityWith<TypeList<First, Last>>([&](Entity, First& a, Last& b) {
+                sum += a.value + b.value;
+            });
+        }
+
+        const char* name(void) const override
+        {
+            return "SumSystem";
+        }
+};
+
+static double elapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(void)
+{
+    const std::size_t count = 100000;
+
+    GameManager manager;
+    auto& scene = manager.createScene<Components>("Bench", true);
+    auto& reg = scene.getRegistry();
+    auto* system = new SumSystem();
+    scene.addSystem(system, 10);
+
+    std::vector<Entity> entities;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        Entity e = reg.create();
+        reg.add<First>(e, {});
+        reg.add<Middle>(e, {});
+        if (i % 2 == 0)
+            reg.add<Last>(e, {});
+        entities.push_back(e);
+    }
+    double createMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    manager.update(1.0 / 60.0);
+    double updateMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    for (Entity e : entities)
+        reg.destroy(e);
+    double destroyMs = elapsedMs(start);
+
+    std::cout << BENCH_COMPONENTS << " components | create " << createMs << " ms | update " << updateMs
+              << " ms (" << system->sum << ") | destroy x" << count << " " << destroyMs << " ms" << std::endl;
+    return 0;
+}
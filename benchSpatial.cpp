@@ -0,0 +1,109 @@
+#include "ECS.hpp"
+#include "SpatialIndex.hpp"
+#include <chrono>
+#include <random>
+
+struct Position { float x = 0, y = 0; };
+struct Velocity { float vx = 0, vy = 0; };
+
+using Components = TypeList<Position, Velocity>;
+
+class MovementSystem : public SystemTypeList<Components>
+{
+    public:
+
+        void update(double dt, Registry<Signature>& reg) override
+        {
+            reg.template forEachEntityWith<Signature>([&](Entity, Position& pos, Velocity& vel) {
+                pos.x += vel.vx * dt;
+                pos.y += vel.vy * dt;
+                if (pos.x < 0 || pos.x > 1000) vel.vx = -vel.vx;
+                if (pos.y < 0 || pos.y > 1000) vel.vy = -vel.vy;
+            });
+        }
+
+        const char* name(void) const override
+        {
+            return "MovementSystem";
+        }
+};
+
+static double elapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(void)
+{
+    const std::size_t count = 100000;
+    const std::size_t probes = 1000;
+    const float radius = 10.0f;
+    const int frames = 5;
+
+    Registry<Components> reg;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> coord(0.0f, 1000.0f);
+    std::uniform_real_distribution<float> speed(-20.0f, 20.0f);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        Entity e = reg.create();
+        reg.add<Position>(e, {coord(rng), coord(rng)});
+        reg.add<Velocity>(e, {speed(rng), speed(rng)});
+    }
+
+    SpatialGrid<Components, Position> grid(reg, 0.0f, 0.0f, 1000.0f, 1000.0f, 2.0f * radius);
+    MovementSystem movement;
+    std::vector<Entity> all = reg.storage<Position>().entities();
+
+    for (int f = 0; f < frames; f++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        movement.update(1.0 / 60.0, reg);
+        double moveMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        grid.refresh();
+        double refreshMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        std::size_t gridHits = 0;
+        for (std::size_t p = 0; p < probes; p++)
+        {
+            const Position& c = reg.storage<Position>().get(all[p * (count / probes)]);
+            gridHits += grid.queryRadius(c.x, c.y, radius).size();
+        }
+        double gridMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        std::size_t bruteHits = 0;
+        const auto& positions = reg.storage<Position>();
+        for (std::size_t p = 0; p < probes; p++)
+        {
+            const Position& c = positions.get(all[p * (count / probes)]);
+            for (std::size_t i = 0; i < positions.size(); i++)
+            {
+                const Position& o = positions.get(positions.entityAt(i));
+                float dx = o.x - c.x;
+                float dy = o.y - c.y;
+                if (dx * dx + dy * dy <= radius * radius)
+                    bruteHits++;
+            }
+        }
+        double bruteMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        std::size_t knn = 0;
+        for (std::size_t p = 0; p < probes; p++)
+        {
+            const Position& c = positions.get(all[p * (count / probes)]);
+            knn += grid.queryNearest(c.x, c.y, 8).size();
+        }
+        double knnMs = elapsedMs(start);
+
+        std::cout << "Frame " << f << " | move " << moveMs << " ms | refresh " << refreshMs << " ms"
+                  << " | grid radius x" << probes << " " << gridMs << " ms (" << gridHits << ")"
+                  << " | brute radius x" << probes << " " << bruteMs << " ms (" << bruteHits << ")"
+                  << " | grid 8-nn x" << probes << " " << knnMs << " ms (" << knn << ")" << std::endl;
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "LiveInspector.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+// Moniteur de référence : ./liveMonitor /segment [idEntité] [--watch ms]
+// Doit être compilé avec la même disposition d'Entity que la simulation (ECS_COMPACT_ENTITY).
+
+static void printFrame(const LiveFrame& frame, long entity)
+{
+    std::cout << "Frame " << frame.frame << std::endl;
+    for (const auto& c : frame.components)
+    {
+        std::cout << "  " << c.name << " : " << c.count << " entities (" << c.elementSize << " bytes)" << std::endl;
+        if (entity < 0)
+            continue;
+        const unsigned char* bytes = frame.find(c, static_cast<std::uint32_t>(entity));
+        if (!bytes)
+            continue;
+        std::cout << "    #" << entity << " :";
+        for (std::uint32_t i = 0; i < c.elementSize; i++)
+            std::printf(" %02x", bytes[i]);
+        std::cout << std::endl;
+    }
+    for (const auto& s : frame.systems)
+    {
+        std::cout << "  [" << s.name << "] runs " << s.runs << " | skipped " << s.skipped << " | last " << s.lastUs
+                  << " us | max " << s.maxUs << " us | avg " << (s.runs ? s.totalUs / s.runs : 0.0) << " us" << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: " << argv[0] << " /segment [entityId] [--watch ms]" << std::endl;
+        return 1;
+    }
+    long entity = -1;
+    long watchMs = 0;
+    for (int i = 2; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--watch" && i + 1 < argc)
+            watchMs = std::atol(argv[++i]);
+        else
+            entity = std::atol(argv[i]);
+    }
+
+    LiveReader reader;
+    if (!reader.open(argv[1]))
+    {
+        std::cerr << "cannot open live segment " << argv[1] << std::endl;
+        return 1;
+    }
+    LiveFrame frame;
+    do
+    {
+        if (reader.read(frame))
+            printFrame(frame, entity);
+        else
+            std::cerr << "no consistent frame yet" << std::endl;
+        if (watchMs > 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(watchMs));
+    } while (watchMs > 0);
+    return 0;
+}
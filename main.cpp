@@ -1,4 +1,6 @@
 #include "ECS.hpp"
+#include "FieldIndex.hpp"
+#include <cassert>
 
 struct Task
 {
@@ -33,14 +35,25 @@ struct Deadline
     std::array<const char*, 1> fieldNames(void) const {return {"Deadline"};}
 };
 
+// Tag : tâche à relancer à chaque rappel
+struct Urgent
+{
+    using Types = TypeList<>;
+    static auto tie(const Urgent&) { return std::tie();}
+    std::array<const char*, 0> fieldNames(void) const {return {};}
+};
+
+using TaskComponents = TypeList<Task, Status, Priority, Deadline, Urgent>;
+using TaskFields = TypeList<Task, Status, Priority, Deadline>;
+
 // Système de progression
-class TaskProgressSystem : public SystemTypeList<TypeList<Task, Status, Priority, Deadline>> 
+class TaskProgressSystem : public SystemTypeList<TaskComponents> 
 {
     public:
 
         void update(double, Registry<Signature>& reg) override 
         {
-            reg.template forEachEntityWith<Signature>([](Entity, Task& t, Status& s, Priority&, Deadline&) {
+            reg.template forEachEntityWith<TaskFields>([](Entity, Task& t, Status& s, Priority&, Deadline&) {
                 if (!s.completed) {
                     std::cout << "[Task] " << t.description << " is still in progress" << std::endl;
                 }
@@ -50,28 +63,28 @@ class TaskProgressSystem : public SystemTypeList<TypeList<Task, Status, Priority
 };
 
 // Système de deadline
-class DeadlineSystem : public SystemTypeList<TypeList<Task, Status, Priority, Deadline>> 
+class DeadlineSystem : public SystemTypeList<TaskComponents> 
 {
     public:
 
         void update(double, Registry<Signature>& reg) override 
         {
-            reg.template forEachEntityWith<Signature>([](Entity e, Task&, Status&, Priority&, Deadline& d) {
+            reg.template forEachEntityWith<TaskFields>([](Entity e, Task&, Status&, Priority&, Deadline& d) {
                 if (d.daysLeft > 0) d.daysLeft--;
-                std::cout << "[Deadline] Task " << e.id << " has " << d.daysLeft << " day(s) left" << std::endl;
+                std::cout << "[Deadline] Task " << e.id() << " has " << d.daysLeft << " day(s) left" << std::endl;
             });
         }
         const char* name(void) const override { return "DeadlineSystem"; }
 };
 
 // Système de print
-class TaskPrintSystem : public SystemTypeList<TypeList<Task, Status, Priority, Deadline>> 
+class TaskPrintSystem : public SystemTypeList<TaskComponents> 
 {
     public:
 
         void update(double, Registry<Signature>& reg) override 
         {
-            reg.template forEachEntityWith<Signature>([](Entity, Task& t, Status& s, Priority& p, Deadline&) {
+            reg.template forEachEntityWith<TaskFields>([](Entity, Task& t, Status& s, Priority& p, Deadline&) {
                 std::cout << "[Task] " << t.description << " | Priority: " << p.level << " | Status: " << (s.completed ? "V" : "X") << std::endl;
             });
         }
@@ -91,6 +104,19 @@ struct EventTraits<TaskCompletedEvent>
     static Entity getTarget(const TaskCompletedEvent& e) {return e.target;}
 };
 
+// Event : rappel diffusé à toutes les tâches taguées Urgent
+struct ReminderEvent
+{
+    int day = 0;
+};
+
+template <typename ComponentList>
+void handleEvent(Scene<ComponentList>* scene, const ReminderEvent& evt, Entity target)
+{
+    if (auto* task = scene->getRegistry().template getIf<Task>(target))
+        std::cout << " Reminder (day " << evt.day << ") : " << task->description << std::endl;
+}
+
 // Event handler
 template <typename ComponentList>
 void handleEvent(Scene<ComponentList>* scene, const TaskCompletedEvent&, Entity target) 
@@ -99,13 +125,13 @@ void handleEvent(Scene<ComponentList>* scene, const TaskCompletedEvent&, Entity
     if (auto* status = reg.template getIf<Status>(target))
     {
         status->completed = true;
-        std::cout << " Task " << target.id << " has been marked as completed!" << std::endl;
+        std::cout << " Task " << target.id() << " has been marked as completed!" << std::endl;
     }
 }
 
 int main(void) 
 {
-    using Components = TypeList<Task, Status, Priority, Deadline>;
+    using Components = TaskComponents;
     GameManager manager;
 
     // Scene 1 : Team Alpha
@@ -117,11 +143,14 @@ int main(void)
     reg1.add<Status>(t1, {false});
     reg1.add<Priority>(t1, {2});
     reg1.add<Deadline>(t1, {5});
+    reg1.add<Urgent>(t1, {});
 
     teamAlpha.addSystem(new TaskProgressSystem(), 10);
     teamAlpha.addSystem(new DeadlineSystem(), 20);
     teamAlpha.addSystem(new TaskPrintSystem(), 30);
     teamAlpha.bindRouter<TaskCompletedEvent>();
+    teamAlpha.addEventRouter<ReminderEvent, Urgent>();
+    teamAlpha.bindRouter<ReminderEvent>();
 
     // Scene 2 : Team Beta
     auto& teamBeta = manager.createScene<Components>("TeamBeta", true);
@@ -139,6 +168,7 @@ int main(void)
 
     manager.run(3, 1.0);
 
+    EventBus::instance().publish(ReminderEvent{3});
     EventBus::instance().publish(TaskCompletedEvent{t2});
     std::cout << "After completion:" << std::endl;
     manager.run(1, 0.5);
@@ -150,7 +180,7 @@ int main(void)
     for (Entity e : reg1.getAliveEntities()) 
     {
         auto info = inspector.inspectEntity(reg1, e);
-        std::cout << "Entity " << info.id.id << std::endl;
+        std::cout << "Entity " << info.id.id() << std::endl;
         for (const auto& comp : info.components) {
             std::cout << " - " << comp.typeName << " : { ";
             for (const auto& field : comp.fields) {
@@ -160,5 +190,40 @@ int main(void)
         }
     }
 
+    // Index secondaires : tâches incomplètes de priorité >= 2 dues dans moins de 3 jours
+    std::cout << "\n Secondary indexes :" << std::endl;
+    SortedIndex<Components, Priority> byPriority(reg1);
+    HashIndex<Components, Status> byStatus(reg1);
+    const char* backlog[] = {"Fix allocator", "Profile scenes", "Update Readme"};
+    for (int i = 0; i < 3; i++)
+    {
+        Entity t = reg1.create();
+        reg1.add<Task>(t, {backlog[i]});
+        reg1.add<Status>(t, {false});
+        reg1.add<Priority>(t, {i + 1});
+        reg1.add<Deadline>(t, {i + 1});
+    }
+    reg1.forEachEntityWith<TypeList<Task, Status, Deadline>>(byPriority.atLeast(2), [](Entity, Task& t, Status& s, Deadline& d) {
+        if (!s.completed && d.daysLeft < 3)
+            std::cout << "[Urgent] " << t.description << " (" << d.daysLeft << " day(s) left)" << std::endl;
+    });
+    std::cout << "Incomplete tasks : " << byStatus.count(false) << std::endl;
+
+    // Id recyclé entre deux requêtes : les index ne doivent garder que le handle vivant
+    Entity dropped = reg1.create();
+    reg1.add<Priority>(dropped, {9});
+    reg1.add<Status>(dropped, {true});
+    byPriority.equal(9);
+    byStatus.equal(true);
+    reg1.destroy(dropped);
+    Entity reused = reg1.create();
+    reg1.add<Priority>(reused, {7});
+    reg1.add<Status>(reused, {true});
+    EntityRange sevens = byPriority.equal(7);
+    EntityRange done = byStatus.equal(true);
+    assert(sevens.size() == 1 && sevens.first[0] == reused && reg1.valid(sevens.first[0]));
+    assert(done.size() == 1 && done.first[0] == reused && reg1.valid(done.first[0]));
+    assert(byPriority.equal(9).empty());
+
     return 0;
 }
\ No newline at end of file
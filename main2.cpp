@@ -50,7 +50,7 @@ class PrintSystem : public SystemTypeList<TypeList<Heal, Mana>>
         void update(double, Registry<Signature>& reg) override
         {
             reg.template forEachEntityWith<Signature>([](Entity& e, Heal& h, Mana& m) {
-                std::cout << " Entity " << e.id << " :  HP : " << h.hp << " MP: " << m.mp << " | ";
+                std::cout << " Entity " << e.id() << " :  HP : " << h.hp << " MP: " << m.mp << " | ";
             });
             std::cout << "\n";
         }
@@ -79,7 +79,7 @@ void handleEvent(Scene<TypeList<Heal, Mana>>* scene, const DamageEvent& evt, Ent
     auto& reg = scene->getRegistry();
     auto* h = reg.template getIf<Heal>(target);
     h->hp -= evt.amount;
-    std::cout << "[EventDamage] on target.id " << target.id << " took " << evt.amount << " damage, rest " << h->hp << " hp" << std::endl;
+    std::cout << "[EventDamage] on target.id " << target.id() << " took " << evt.amount << " damage, rest " << h->hp << " hp" << std::endl;
 }
 
 